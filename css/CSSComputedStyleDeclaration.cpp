@@ -2322,6 +2322,10 @@ static bool updateStyleIfNeededForProperty(Element& element, CSSPropertyID prope
     if (hasValidStyle)
         return false;
 
+    // Styles in 'display: none' subtrees are resolved on demand, so querying hidden content doesn't need a full style update.
+    if (element.prepareComputedStyleInNonRenderedSubtree())
+        return false;
+
     document.updateStyleIfNeeded();
     return true;
 }
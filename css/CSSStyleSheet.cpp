@@ -155,7 +155,7 @@ void CSSStyleSheet::didMutateRuleFromCSSStyleDeclaration()
     didMutate();
 }
 
-void CSSStyleSheet::didMutateRules(RuleMutationType mutationType, WhetherContentsWereClonedForMutation contentsWereClonedForMutation, StyleRuleKeyframes* insertedKeyframesRule)
+void CSSStyleSheet::didMutateRules(RuleMutationType mutationType, WhetherContentsWereClonedForMutation contentsWereClonedForMutation, StyleRuleBase* insertedRule)
 {
     ASSERT(m_contents->isMutable());
     ASSERT(m_contents->hasOneClient());
@@ -165,16 +165,20 @@ void CSSStyleSheet::didMutateRules(RuleMutationType mutationType, WhetherContent
         return;
 
     if (mutationType == RuleInsertion && !contentsWereClonedForMutation && !scope->activeStyleSheetsContains(this)) {
-        if (insertedKeyframesRule) {
+        if (insertedRule && is<StyleRuleKeyframes>(*insertedRule)) {
             if (auto* resolver = scope->resolverIfExists())
-                resolver->addKeyframeStyle(*insertedKeyframesRule);
+                resolver->addKeyframeStyle(downcast<StyleRuleKeyframes>(*insertedRule));
             return;
         }
         scope->didChangeActiveStyleSheetCandidates();
         return;
     }
 
-    scope->didChangeStyleSheetContents();
+    // Appending a style rule to an active stylesheet doesn't require rebuilding the author rule set from scratch.
+    bool didAppendIncrementally = mutationType == RuleInsertion && !contentsWereClonedForMutation && insertedRule && is<StyleRule>(*insertedRule)
+        && scope->didAppendStyleRule(*this, downcast<StyleRule>(*insertedRule));
+    if (!didAppendIncrementally)
+        scope->didChangeStyleSheetContents();
 
     m_mutatedRules = true;
 }
@@ -285,9 +289,9 @@ ExceptionOr<unsigned> CSSStyleSheet::insertRule(const String& ruleString, unsign
     if (!rule)
         return Exception { SyntaxError };
 
-    RuleMutationScope mutationScope(this, RuleInsertion, is<StyleRuleKeyframes>(*rule) ? downcast<StyleRuleKeyframes>(rule.get()) : nullptr);
+    RuleMutationScope mutationScope(this, RuleInsertion, rule.get());
 
-    bool success = m_contents.get().wrapperInsertRule(rule.releaseNonNull(), index);
+    bool success = m_contents.get().wrapperInsertRule(*rule, index);
     if (!success)
         return Exception { HierarchyRequestError };
     if (!m_childRuleCSSOMWrappers.isEmpty())
@@ -411,10 +415,10 @@ void CSSStyleSheet::clearChildRuleCSSOMWrappers()
     m_childRuleCSSOMWrappers.clear();
 }
 
-CSSStyleSheet::RuleMutationScope::RuleMutationScope(CSSStyleSheet* sheet, RuleMutationType mutationType, StyleRuleKeyframes* insertedKeyframesRule)
+CSSStyleSheet::RuleMutationScope::RuleMutationScope(CSSStyleSheet* sheet, RuleMutationType mutationType, StyleRuleBase* insertedRule)
     : m_styleSheet(sheet)
     , m_mutationType(mutationType)
-    , m_insertedKeyframesRule(insertedKeyframesRule)
+    , m_insertedRule(insertedRule)
 {
     ASSERT(m_styleSheet);
     m_contentsWereClonedForMutation = m_styleSheet->willMutateRules();
@@ -424,7 +428,7 @@ CSSStyleSheet::RuleMutationScope::RuleMutationScope(CSSRule* rule)
     : m_styleSheet(rule ? rule->parentStyleSheet() : nullptr)
     , m_mutationType(OtherMutation)
     , m_contentsWereClonedForMutation(ContentsWereNotClonedForMutation)
-    , m_insertedKeyframesRule(nullptr)
+    , m_insertedRule(nullptr)
 {
     if (m_styleSheet)
         m_contentsWereClonedForMutation = m_styleSheet->willMutateRules();
@@ -433,7 +437,7 @@ CSSStyleSheet::RuleMutationScope::RuleMutationScope(CSSRule* rule)
 CSSStyleSheet::RuleMutationScope::~RuleMutationScope()
 {
     if (m_styleSheet)
-        m_styleSheet->didMutateRules(m_mutationType, m_contentsWereClonedForMutation, m_insertedKeyframesRule);
+        m_styleSheet->didMutateRules(m_mutationType, m_contentsWereClonedForMutation, m_insertedRule);
 }
 
 }
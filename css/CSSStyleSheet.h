@@ -39,7 +39,7 @@ class CachedCSSStyleSheet;
 class Document;
 class Element;
 class MediaQuerySet;
-class StyleRuleKeyframes;
+class StyleRuleBase;
 class StyleSheetContents;
 
 namespace Style {
@@ -102,7 +102,7 @@ public:
     class RuleMutationScope {
         WTF_MAKE_NONCOPYABLE(RuleMutationScope);
     public:
-        RuleMutationScope(CSSStyleSheet*, RuleMutationType = OtherMutation, StyleRuleKeyframes* insertedKeyframesRule = nullptr);
+        RuleMutationScope(CSSStyleSheet*, RuleMutationType = OtherMutation, StyleRuleBase* insertedRule = nullptr);
         RuleMutationScope(CSSRule*);
         ~RuleMutationScope();
 
@@ -110,11 +110,11 @@ public:
         CSSStyleSheet* m_styleSheet;
         RuleMutationType m_mutationType;
         WhetherContentsWereClonedForMutation m_contentsWereClonedForMutation;
-        StyleRuleKeyframes* m_insertedKeyframesRule;
+        StyleRuleBase* m_insertedRule;
     };
 
     WhetherContentsWereClonedForMutation willMutateRules();
-    void didMutateRules(RuleMutationType, WhetherContentsWereClonedForMutation, StyleRuleKeyframes* insertedKeyframesRule);
+    void didMutateRules(RuleMutationType, WhetherContentsWereClonedForMutation, StyleRuleBase* insertedRule);
     void didMutateRuleFromCSSStyleDeclaration();
     void didMutate();
     
@@ -30,6 +30,7 @@
 #include "config.h"
 #include "CSSVariableReferenceValue.h"
 
+#include "CSSCustomPropertyValue.h"
 #include "CSSVariableData.h"
 #include "ConstantPropertyMap.h"
 #include "RenderStyle.h"
@@ -131,7 +132,87 @@ static bool resolveTokenRange(CSSParserTokenRange range, Vector<CSSParserToken>&
     return success;
 }
 
+static bool collectVariableDependencies(CSSParserTokenRange range, Vector<AtomString>& dependencies)
+{
+    while (!range.atEnd()) {
+        auto functionId = range.peek().functionId();
+        if (functionId == CSSValueEnv)
+            return false;
+        if (functionId != CSSValueVar) {
+            range.consume();
+            continue;
+        }
+        auto block = range.consumeBlock();
+        block.consumeWhitespace();
+        dependencies.append(block.consumeIncludingWhitespace().value().toAtomString());
+        if (!collectVariableDependencies(block, dependencies))
+            return false;
+    }
+    return true;
+}
+
+bool CSSVariableReferenceValue::collectVariableDependenciesIfNeeded() const
+{
+    if (!m_didCollectVariableDependencies) {
+        m_didCollectVariableDependencies = true;
+        m_isResolutionCacheable = collectVariableDependencies(m_data->tokenRange(), m_variableDependencies);
+        if (!m_isResolutionCacheable)
+            m_variableDependencies.clear();
+        m_variableDependencies.shrinkToFit();
+    }
+    return m_isResolutionCacheable;
+}
+
 RefPtr<CSSVariableData> CSSVariableReferenceValue::resolveVariableReferences(Style::BuilderState& builderState) const
+{
+    if (!collectVariableDependenciesIfNeeded())
+        return resolveVariableReferencesWithoutCache(builderState);
+
+    auto collectDependencyValues = [&] {
+        Vector<RefPtr<const CSSCustomPropertyValue>> values;
+        values.reserveInitialCapacity(m_variableDependencies.size());
+        for (auto& name : m_variableDependencies) {
+            auto* value = builderState.style().getCustomProperty(name);
+            // Missing and unset properties resolve to registered initial values which depend on the document.
+            if (!value || value->isUnset())
+                return Optional<Vector<RefPtr<const CSSCustomPropertyValue>>> { };
+            values.uncheckedAppend(value);
+        }
+        return makeOptional(WTFMove(values));
+    };
+
+    auto dependencyValuesEqual = [](auto& a, auto& b) {
+        if (a.size() != b.size())
+            return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (a[i] != b[i] && !a[i]->equals(*b[i]))
+                return false;
+        }
+        return true;
+    };
+
+    // Apply the referenced properties first like resolution does, so the values compared below are final.
+    for (auto& name : m_variableDependencies)
+        builderState.builder().applyCustomProperty(name);
+
+    auto dependencyValues = collectDependencyValues();
+    if (!dependencyValues)
+        return resolveVariableReferencesWithoutCache(builderState);
+
+    if (m_cachedResolution && dependencyValuesEqual(m_cachedResolution->dependencyValues, *dependencyValues))
+        return m_cachedResolution->data;
+
+    auto data = resolveVariableReferencesWithoutCache(builderState);
+
+    // Resolution may reset properties involved in a cycle. Only cache results that are a function of the values we recorded.
+    auto dependencyValuesAfterResolution = collectDependencyValues();
+    if (dependencyValuesAfterResolution && dependencyValuesEqual(*dependencyValuesAfterResolution, *dependencyValues))
+        m_cachedResolution = CachedResolution { WTFMove(*dependencyValues), data };
+
+    return data;
+}
+
+RefPtr<CSSVariableData> CSSVariableReferenceValue::resolveVariableReferencesWithoutCache(Style::BuilderState& builderState) const
 {
     Vector<CSSParserToken> resolvedTokens;
     if (!resolveTokenRange(m_data->tokenRange(), resolvedTokens, builderState))
@@ -30,9 +30,13 @@
 #pragma once
 
 #include "CSSValue.h"
+#include <wtf/Optional.h>
+#include <wtf/Vector.h>
+#include <wtf/text/AtomString.h>
 
 namespace WebCore {
 
+class CSSCustomPropertyValue;
 class CSSParserTokenRange;
 class CSSVariableData;
 
@@ -57,8 +61,24 @@ public:
 private:
     explicit CSSVariableReferenceValue(Ref<CSSVariableData>&&);
 
+    RefPtr<CSSVariableData> resolveVariableReferencesWithoutCache(Style::BuilderState&) const;
+    bool collectVariableDependenciesIfNeeded() const;
+
     Ref<CSSVariableData> m_data;
     mutable String m_stringValue;
+
+    // Custom properties referenced by var(), including the ones in fallbacks, in resolution order.
+    mutable Vector<AtomString> m_variableDependencies;
+    mutable bool m_didCollectVariableDependencies { false };
+    // Values referencing env() depend on the document and are not cached.
+    mutable bool m_isResolutionCacheable { false };
+
+    // The last resolution and the values of the referenced custom properties it was computed from.
+    struct CachedResolution {
+        Vector<RefPtr<const CSSCustomPropertyValue>> dependencyValues;
+        RefPtr<CSSVariableData> data;
+    };
+    mutable Optional<CachedResolution> m_cachedResolution;
 };
 
 } // namespace WebCore
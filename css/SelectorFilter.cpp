@@ -43,7 +43,8 @@ static bool isExcludedAttribute(const AtomString& name)
     return name == HTMLNames::classAttr->localName() || name == HTMLNames::idAttr->localName() || name == HTMLNames::styleAttr->localName();
 }
 
-static inline void collectElementIdentifierHashes(const Element& element, Vector<unsigned, 4>& identifierHashes)
+template<typename HashVector>
+static inline void collectElementIdentifierHashes(const Element& element, HashVector& identifierHashes)
 {
     AtomString tagLowercaseLocalName = element.localName().convertToASCIILowercase();
     identifierHashes.append(tagLowercaseLocalName.impl()->existingHash() * TagNameSalt);
@@ -90,14 +91,14 @@ void SelectorFilter::pushParent(Element* parent)
 {
     ASSERT(m_parentStack.isEmpty() || m_parentStack.last().element == parent->parentElement());
     ASSERT(!m_parentStack.isEmpty() || !parent->parentElement());
-    m_parentStack.append(ParentStackFrame(parent));
-    ParentStackFrame& parentFrame = m_parentStack.last();
     // Mix tags, class names and ids into some sort of weird bouillabaisse.
     // The filter is used for fast rejection of child and descendant selectors.
-    collectElementIdentifierHashes(*parent, parentFrame.identifierHashes);
-    size_t count = parentFrame.identifierHashes.size();
-    for (size_t i = 0; i < count; ++i)
-        m_ancestorIdentifierFilter.add(parentFrame.identifierHashes[i]);
+    size_t start = m_identifierHashStack.size();
+    collectElementIdentifierHashes(*parent, m_identifierHashStack);
+    size_t end = m_identifierHashStack.size();
+    for (size_t i = start; i < end; ++i)
+        m_ancestorIdentifierFilter.add(m_identifierHashStack[i]);
+    m_parentStack.append({ parent, static_cast<unsigned>(end - start) });
 }
 
 void SelectorFilter::pushParentInitializingIfNeeded(Element& parent)
@@ -112,12 +113,14 @@ void SelectorFilter::pushParentInitializingIfNeeded(Element& parent)
 void SelectorFilter::popParent()
 {
     ASSERT(!m_parentStack.isEmpty());
-    const ParentStackFrame& parentFrame = m_parentStack.last();
-    size_t count = parentFrame.identifierHashes.size();
-    for (size_t i = 0; i < count; ++i)
-        m_ancestorIdentifierFilter.remove(parentFrame.identifierHashes[i]);
+    size_t end = m_identifierHashStack.size();
+    size_t start = end - m_parentStack.last().identifierHashCount;
+    for (size_t i = start; i < end; ++i)
+        m_ancestorIdentifierFilter.remove(m_identifierHashStack[i]);
+    m_identifierHashStack.shrink(start);
     m_parentStack.removeLast();
     if (m_parentStack.isEmpty()) {
+        ASSERT(m_identifierHashStack.isEmpty());
         ASSERT(m_ancestorIdentifierFilter.likelyEmpty());
         m_ancestorIdentifierFilter.clear();
     }
@@ -54,12 +54,12 @@ private:
     void initializeParentStack(Element& parent);
 
     struct ParentStackFrame {
-        ParentStackFrame() : element(0) { }
-        ParentStackFrame(Element* element) : element(element) { }
         Element* element;
-        Vector<unsigned, 4> identifierHashes;
+        unsigned identifierHashCount;
     };
     Vector<ParentStackFrame> m_parentStack;
+    // Identifier hashes of all frames in stack order, so pushing a parent doesn't need a per-frame allocation.
+    Vector<unsigned, 64> m_identifierHashStack;
 
     // With 100 unique strings in the filter, 2^12 slot table has false positive rate of ~0.2%.
     static const unsigned bloomFilterKeyBits = 12;
@@ -6990,6 +6990,8 @@ bool Document::processingUserGestureForMedia() const
 void Document::startTrackingStyleRecalcs()
 {
     m_styleRecalcCount = 0;
+    m_styleInvalidationCheckCount = 0;
+    m_styleInvalidationCount = 0;
 }
 
 unsigned Document::styleRecalcCount() const
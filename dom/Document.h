@@ -1247,6 +1247,16 @@ public:
     WEBCORE_EXPORT void startTrackingStyleRecalcs();
     WEBCORE_EXPORT unsigned styleRecalcCount() const;
 
+    // Elements tested against invalidation rule sets, and how many of those were invalidated, since startTrackingStyleRecalcs().
+    unsigned styleInvalidationCheckCount() const { return m_styleInvalidationCheckCount; }
+    unsigned styleInvalidationCount() const { return m_styleInvalidationCount; }
+    void didCheckElementForStyleInvalidation(bool didInvalidate)
+    {
+        ++m_styleInvalidationCheckCount;
+        if (didInvalidate)
+            ++m_styleInvalidationCount;
+    }
+
 #if ENABLE(TOUCH_EVENTS)
     bool hasTouchEventHandlers() const { return m_touchEventTargets.get() ? m_touchEventTargets->size() : false; }
     bool touchEventTargetsContain(Node& node) const { return m_touchEventTargets ? m_touchEventTargets->contains(&node) : false; }
@@ -2031,6 +2041,8 @@ private:
 
     unsigned m_activeParserCount { 0 };
     unsigned m_styleRecalcCount { 0 };
+    unsigned m_styleInvalidationCheckCount { 0 };
+    unsigned m_styleInvalidationCount { 0 };
 
     unsigned m_writeRecursionDepth { 0 };
 
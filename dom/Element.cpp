@@ -3425,6 +3425,64 @@ bool Element::isVisibleWithoutResolvingFullStyle() const
     return true;
 }
 
+bool Element::prepareComputedStyleInNonRenderedSubtree()
+{
+    if (!isConnected() || isPseudoElement() || renderOrDisplayContentsStyle())
+        return false;
+
+    if (document().hasPendingFullStyleRebuild())
+        return false;
+
+    // Find the root of the non-rendered subtree and the closest ancestor whose style is kept up to date by the tree resolver.
+    Element* nonRenderedRoot = this;
+    Element* styledAncestor = nullptr;
+    for (auto& ancestor : composedTreeAncestors(*this)) {
+        if (ancestor.renderOrDisplayContentsStyle()) {
+            styledAncestor = &ancestor;
+            break;
+        }
+        nonRenderedRoot = &ancestor;
+    }
+    if (!styledAncestor)
+        return false;
+
+    // Everything the root inherits from must be valid.
+    if (styledAncestor->styleValidity() != Style::Validity::Valid)
+        return false;
+    if (styledAncestor->directChildNeedsStyleRecalc() && nonRenderedRoot->styleIsAffectedByPreviousSibling())
+        return false;
+    const Element* current = styledAncestor;
+    for (auto& ancestor : composedTreeAncestors(*styledAncestor)) {
+        if (ancestor.styleValidity() != Style::Validity::Valid)
+            return false;
+        if (ancestor.directChildNeedsStyleRecalc() && current->styleIsAffectedByPreviousSibling())
+            return false;
+        current = &ancestor;
+    }
+
+    if (nonRenderedRoot->styleValidity() != Style::Validity::Valid)
+        return false;
+
+    auto* rootStyle = nonRenderedRoot->existingComputedStyle();
+    if (!rootStyle)
+        rootStyle = nonRenderedRoot->resolveComputedStyle();
+    if (!rootStyle || rootStyle->display() != DisplayType::None)
+        return false;
+
+    // The tree resolver never descends into the subtree. Do what it would do there so that computed styles get
+    // resolved on demand and stay cached until the subtree is invalidated again.
+    if (nonRenderedRoot->childNeedsStyleRecalc())
+        Style::resetStyleForNonRenderedDescendants(*nonRenderedRoot);
+
+    // Shadow trees within the subtree are not reset.
+    for (auto* element = this; element != nonRenderedRoot; element = element->parentElementInComposedTree()) {
+        if (!element || element->styleValidity() != Style::Validity::Valid)
+            return false;
+    }
+
+    return true;
+}
+
 const RenderStyle& Element::resolvePseudoElementStyle(PseudoId pseudoElementSpecifier)
 {
     ASSERT(!isPseudoElement());
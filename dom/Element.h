@@ -553,6 +553,9 @@ public:
 
     const RenderStyle* existingComputedStyle() const;
     WEBCORE_EXPORT const RenderStyle* renderOrDisplayContentsStyle(PseudoId = PseudoId::None) const;
+    // Lets computedStyle() resolve an up-to-date style for an element in a 'display: none' subtree without a document style update.
+    // Returns false if style outside the subtree is invalid and a style update is required.
+    bool prepareComputedStyleInNonRenderedSubtree();
 
     void clearBeforePseudoElement();
     void clearAfterPseudoElement();
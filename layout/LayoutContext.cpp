@@ -32,6 +32,7 @@
 #include "BlockFormattingState.h"
 #include "FlexFormattingContext.h"
 #include "FlexFormattingState.h"
+#include "FrameViewLayoutContext.h"
 #include "InlineFormattingContext.h"
 #include "InlineFormattingState.h"
 #include "InvalidationContext.h"
@@ -54,8 +55,9 @@ namespace Layout {
 
 WTF_MAKE_ISO_ALLOCATED_IMPL(LayoutContext);
 
-LayoutContext::LayoutContext(LayoutState& layoutState)
+LayoutContext::LayoutContext(LayoutState& layoutState, FrameViewLayoutContext* frameViewLayoutContext)
     : m_layoutState(layoutState)
+    , m_frameViewLayoutContext(frameViewLayoutContext)
 {
 }
 
@@ -86,8 +88,24 @@ void LayoutContext::layoutWithPreparedRootGeometry(InvalidationState& invalidati
     if (formattingContextRootsForLayout.computesEmpty())
         return layoutFormattingContextSubtree(m_layoutState.root(), invalidationState);
 
-    for (auto& formattingContextRoot : formattingContextRootsForLayout)
+    // Laying out a formatting context root's subtree also lays out every formatting context nested inside it.
+    // Skip the invalidated roots that are already covered by an invalidated ancestor root. What remains is a set of
+    // formatting context subtrees that are independent of each other.
+    auto hasInvalidatedAncestorRoot = [&](auto& formattingContextRoot) {
+        if (&formattingContextRoot == &m_layoutState.root() || formattingContextRoot.isInitialContainingBlock())
+            return false;
+        for (auto* ancestor = &formattingContextRoot.formattingContextRoot(); ; ancestor = &ancestor->formattingContextRoot()) {
+            if (formattingContextRootsForLayout.contains(*ancestor))
+                return true;
+            if (ancestor == &m_layoutState.root() || ancestor->isInitialContainingBlock())
+                return false;
+        }
+    };
+    for (auto& formattingContextRoot : formattingContextRootsForLayout) {
+        if (hasInvalidatedAncestorRoot(formattingContextRoot))
+            continue;
         layoutFormattingContextSubtree(formattingContextRoot, invalidationState);
+    }
 }
 
 void LayoutContext::layoutFormattingContextSubtree(const ContainerBox& formattingContextRoot, InvalidationState& invalidationState)
@@ -96,6 +114,17 @@ void LayoutContext::layoutFormattingContextSubtree(const ContainerBox& formattin
     if (!formattingContextRoot.hasChild())
         return;
 
+    if (LIKELY(!m_frameViewLayoutContext || !m_frameViewLayoutContext->isTrackingLayoutStatistics()))
+        return layoutFormattingContextSubtreeContent(formattingContextRoot, invalidationState);
+
+    // The time includes the formatting contexts nested inside this one.
+    auto startTime = MonotonicTime::now();
+    layoutFormattingContextSubtreeContent(formattingContextRoot, invalidationState);
+    m_frameViewLayoutContext->recordLayoutStatistics(formattingContextName(formattingContextRoot), { }, MonotonicTime::now() - startTime);
+}
+
+void LayoutContext::layoutFormattingContextSubtreeContent(const ContainerBox& formattingContextRoot, InvalidationState& invalidationState)
+{
     auto formattingContext = createFormattingContext(formattingContextRoot, layoutState());
     auto& boxGeometry = layoutState().geometryForBox(formattingContextRoot);
 
@@ -114,6 +143,21 @@ void LayoutContext::layoutFormattingContextSubtree(const ContainerBox& formattin
     }
 }
 
+const char* LayoutContext::formattingContextName(const ContainerBox& formattingContextRoot)
+{
+    // Matches the formatting context createFormattingContext() constructs for the root.
+    if (formattingContextRoot.establishesInlineFormattingContext())
+        return "InlineFormattingContext";
+    if (formattingContextRoot.establishesBlockFormattingContext())
+        return formattingContextRoot.isTableWrapperBox() ? "TableWrapperBlockFormattingContext" : "BlockFormattingContext";
+    if (formattingContextRoot.establishesFlexFormattingContext())
+        return "FlexFormattingContext";
+    if (formattingContextRoot.establishesTableFormattingContext())
+        return "TableFormattingContext";
+    ASSERT_NOT_REACHED();
+    return "FormattingContext";
+}
+
 std::unique_ptr<FormattingContext> LayoutContext::createFormattingContext(const ContainerBox& formattingContextRoot, LayoutState& layoutState)
 {
     ASSERT(formattingContextRoot.establishesFormattingContext());
@@ -32,6 +32,7 @@
 
 namespace WebCore {
 
+class FrameViewLayoutContext;
 class GraphicsContext;
 class IntRect;
 class LayoutSize;
@@ -52,7 +53,8 @@ class FormattingContext;
 class LayoutContext {
     WTF_MAKE_ISO_ALLOCATED(LayoutContext);
 public:
-    LayoutContext(LayoutState&);
+    // Layout time per formatting context type is reported to the FrameViewLayoutContext when it tracks layout statistics.
+    LayoutContext(LayoutState&, FrameViewLayoutContext* = nullptr);
 
     void layout(const LayoutSize& rootContentBoxSize, InvalidationState&);
     void layoutWithPreparedRootGeometry(InvalidationState&);
@@ -66,9 +68,12 @@ public:
 
 private:
     void layoutFormattingContextSubtree(const ContainerBox&, InvalidationState&);
+    void layoutFormattingContextSubtreeContent(const ContainerBox&, InvalidationState&);
+    static const char* formattingContextName(const ContainerBox&);
     LayoutState& layoutState() { return m_layoutState; }
 
     LayoutState& m_layoutState;
+    FrameViewLayoutContext* m_frameViewLayoutContext { nullptr };
 };
 
 }
@@ -385,6 +385,49 @@ Optional<LayoutUnit> FloatingContext::top() const
     return top;
 }
 
+class InnerMostFloatsAdapter {
+public:
+    using IntervalType = FloatingState::FloatInterval;
+
+    InnerMostFloatsAdapter(const FloatingState::FloatList& floats, LayoutUnit candidateTop, LayoutUnit candidateBottom)
+        : m_floats(floats)
+        , m_candidateTop(candidateTop)
+        , m_candidateBottom(candidateBottom)
+    {
+    }
+
+    const LayoutUnit& lowValue() const { return m_candidateTop; }
+    const LayoutUnit& highValue() const { return m_candidateBottom; }
+    void collectIfNeeded(const IntervalType&);
+
+    Optional<unsigned> innerMostLeftIndex() const { return m_innerMostLeftIndex; }
+    Optional<unsigned> innerMostRightIndex() const { return m_innerMostRightIndex; }
+
+private:
+    const FloatingState::FloatList& m_floats;
+    LayoutUnit m_candidateTop;
+    LayoutUnit m_candidateBottom;
+    Optional<unsigned> m_innerMostLeftIndex;
+    Optional<unsigned> m_innerMostRightIndex;
+};
+
+inline void InnerMostFloatsAdapter::collectIfNeeded(const IntervalType& interval)
+{
+    // The interval tree reports closed interval overlaps. Float boxes only constrain the candidate range when
+    // they actually intersect it (or contain its top, in case of an empty candidate).
+    auto floatTop = interval.low();
+    auto floatBottom = interval.high();
+    auto isCandidateEmpty = m_candidateTop == m_candidateBottom;
+    auto intersects = isCandidateEmpty ? floatTop <= m_candidateTop && floatBottom > m_candidateTop : floatTop < m_candidateBottom && floatBottom > m_candidateTop;
+    if (!intersects)
+        return;
+
+    auto index = interval.data();
+    auto& innerMostIndex = m_floats[index].isLeftPositioned() ? m_innerMostLeftIndex : m_innerMostRightIndex;
+    if (!innerMostIndex || *innerMostIndex < index)
+        innerMostIndex = index;
+}
+
 FloatingContext::Constraints FloatingContext::constraints(LayoutUnit candidateTop, LayoutUnit candidateBottom) const
 {
     if (isEmpty())
@@ -401,35 +444,20 @@ FloatingContext::Constraints FloatingContext::constraints(LayoutUnit candidateTo
         adjustingDelta = { adjustedCandidatePosition.x, adjustedCandidateTop - candidateTop };
     }
     auto adjustedCandidateBottom = adjustedCandidateTop + (candidateBottom - candidateTop);
-    auto isCandidateEmpty = adjustedCandidateTop == adjustedCandidateBottom;
 
-    Constraints constraints;
+    // The inner-most left/right float boxes are the last ones in the float list (document order) that intersect the candidate range.
     auto& floats = floatingState().floats();
-    for (auto index = floats.size(); index--;) {
-        auto& floatItem = floats[index];
-
-        if (constraints.left && floatItem.isLeftPositioned())
-            continue;
+    InnerMostFloatsAdapter adapter(floats, adjustedCandidateTop, adjustedCandidateBottom);
+    floatingState().floatIntervalTree().allOverlapsWithAdapter(adapter);
 
-        if (constraints.right && !floatItem.isLeftPositioned())
-            continue;
-
-        auto floatBoxRect = floatItem.rectWithMargin();
-        auto contains = [&] {
-            if (isCandidateEmpty)
-                return floatBoxRect.top() <= adjustedCandidateTop && floatBoxRect.bottom() > adjustedCandidateTop;
-            return floatBoxRect.top() < adjustedCandidateBottom && floatBoxRect.bottom() > adjustedCandidateTop;
-        };
-        if (!contains())
-            continue;
-
-        if (floatItem.isLeftPositioned())
-            constraints.left = PointInContextRoot { floatBoxRect.right(), floatBoxRect.bottom() };
-        else
-            constraints.right = PointInContextRoot { floatBoxRect.left(), floatBoxRect.bottom() };
-
-        if (constraints.left && constraints.right)
-            break;
+    Constraints constraints;
+    if (auto leftIndex = adapter.innerMostLeftIndex()) {
+        auto floatBoxRect = floats[*leftIndex].rectWithMargin();
+        constraints.left = PointInContextRoot { floatBoxRect.right(), floatBoxRect.bottom() };
+    }
+    if (auto rightIndex = adapter.innerMostRightIndex()) {
+        auto floatBoxRect = floats[*rightIndex].rectWithMargin();
+        constraints.right = PointInContextRoot { floatBoxRect.left(), floatBoxRect.bottom() };
     }
 
     if (coordinateMappingIsRequired) {
@@ -59,10 +59,47 @@ FloatingState::FloatingState(LayoutState& layoutState, const ContainerBox& forma
 {
 }
 
+FloatingState::~FloatingState() = default;
+
+static inline FloatingState::FloatInterval intervalForFloatItem(const FloatingState::FloatItem& floatItem, unsigned index)
+{
+    auto rectWithMargin = floatItem.rectWithMargin();
+    return { rectWithMargin.top(), rectWithMargin.bottom(), index };
+}
+
+const FloatingState::FloatIntervalTree& FloatingState::floatIntervalTree() const
+{
+    if (!m_floatIntervalTree) {
+        m_floatIntervalTree = makeUnique<FloatIntervalTree>();
+        for (unsigned index = 0; index < m_floats.size(); ++index)
+            m_floatIntervalTree->add(intervalForFloatItem(m_floats[index], index));
+    }
+    return *m_floatIntervalTree;
+}
+
+void FloatingState::clear()
+{
+    m_floats.clear();
+    m_floatIntervalTree = nullptr;
+}
+
 void FloatingState::append(FloatItem floatItem)
 {
+    auto appendToTheEnd = [&] {
+        m_floats.append(floatItem);
+        if (m_floatIntervalTree)
+            m_floatIntervalTree->add(intervalForFloatItem(m_floats.last(), m_floats.size() - 1));
+    };
+    auto insertAt = [&](size_t index) {
+        if (index == m_floats.size())
+            return appendToTheEnd();
+        m_floats.insert(index, floatItem);
+        // Indexes shift after the insertion point. This is rare (negative horizontal margin), just rebuild the tree on demand.
+        m_floatIntervalTree = nullptr;
+    };
+
     if (m_floats.isEmpty())
-        return m_floats.append(floatItem);
+        return appendToTheEnd();
 
     // The integration codepath does not construct a layout box for the float item.
     ASSERT_IMPLIES(floatItem.floatBox(), m_floats.findMatching([&] (auto& entry) {
@@ -76,19 +113,21 @@ void FloatingState::append(FloatItem floatItem)
     auto horizontalMargin = floatItem.horizontalMargin();
     auto hasNegativeHorizontalMargin = (isLeftPositioned && horizontalMargin.start < 0) || (!isLeftPositioned && horizontalMargin.end < 0);
     if (!hasNegativeHorizontalMargin)
-        return m_floats.append(floatItem);
+        return appendToTheEnd();
 
+    auto newFloatRect = floatItem.rectWithMargin();
     for (int i = m_floats.size() - 1; i >= 0; --i) {
-        auto& floatItem = m_floats[i];
-        if (isLeftPositioned != floatItem.isLeftPositioned())
+        auto& existingFloatItem = m_floats[i];
+        if (isLeftPositioned != existingFloatItem.isLeftPositioned())
             continue;
-        if (floatItem.rectWithMargin().top() < floatItem.rectWithMargin().bottom())
+        auto existingFloatRect = existingFloatItem.rectWithMargin();
+        if (newFloatRect.top() < existingFloatRect.bottom())
             continue;
-        if ((isLeftPositioned && floatItem.rectWithMargin().right() >= floatItem.rectWithMargin().right())
-            || (!isLeftPositioned && floatItem.rectWithMargin().left() <= floatItem.rectWithMargin().left()))
-            return m_floats.insert(i + 1, floatItem);
+        if ((isLeftPositioned && newFloatRect.right() >= existingFloatRect.right())
+            || (!isLeftPositioned && newFloatRect.left() <= existingFloatRect.left()))
+            return insertAt(i + 1);
     }
-    return m_floats.insert(0, floatItem);
+    return insertAt(0);
 }
 
 }
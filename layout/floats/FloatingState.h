@@ -29,6 +29,7 @@
 
 #include "LayoutBoxGeometry.h"
 #include "LayoutContainerBox.h"
+#include "PODIntervalTree.h"
 #include <wtf/IsoMalloc.h>
 #include <wtf/Ref.h>
 #include <wtf/WeakPtr.h>
@@ -48,6 +49,7 @@ class FloatingState : public RefCounted<FloatingState> {
     WTF_MAKE_ISO_ALLOCATED(FloatingState);
 public:
     static Ref<FloatingState> create(LayoutState& layoutState, const ContainerBox& formattingContextRoot) { return adoptRef(*new FloatingState(layoutState, formattingContextRoot)); }
+    ~FloatingState();
 
     const ContainerBox& root() const { return *m_formattingContextRoot; }
 
@@ -78,8 +80,13 @@ public:
     const FloatList& floats() const { return m_floats; }
     const FloatItem* last() const { return floats().isEmpty() ? nullptr : &m_floats.last(); }
 
+    // Vertical extent (margin box) of the float items keyed by their index in the float list.
+    using FloatInterval = PODInterval<LayoutUnit, unsigned>;
+    using FloatIntervalTree = PODIntervalTree<LayoutUnit, unsigned>;
+    const FloatIntervalTree& floatIntervalTree() const;
+
     void append(FloatItem);
-    void clear() { m_floats.clear(); }
+    void clear();
 
 private:
     friend class FloatingContext;
@@ -89,6 +96,7 @@ private:
     LayoutState& m_layoutState;
     WeakPtr<const ContainerBox> m_formattingContextRoot;
     FloatList m_floats;
+    mutable std::unique_ptr<FloatIntervalTree> m_floatIntervalTree;
 };
 
 }
@@ -137,16 +137,19 @@ void InlineFormattingContext::layoutInFlowContent(InvalidationState& invalidatio
     collectInlineContentIfNeeded();
 
     auto& inlineItems = formattingState().inlineItems();
-    lineLayout(inlineItems, { 0, inlineItems.size() }, constraints);
+    lineLayout(inlineItems, { 0, inlineItems.size() }, constraints, { });
     LOG_WITH_STREAM(FormattingContextLayout, stream << "[End] -> inline formatting context -> formatting root(" << &root() << ")");
 }
 
 void InlineFormattingContext::lineLayoutForIntergration(InvalidationState& invalidationState, const ConstraintsForInFlowContent& constraints)
 {
-    invalidateFormattingState(invalidationState);
+    auto lineLayoutStart = invalidateLinesWithDamagedContent(constraints);
+    if (!lineLayoutStart)
+        invalidateFormattingState(invalidationState);
     collectInlineContentIfNeeded();
+    formattingState().setLineLayoutHorizontalConstraints(constraints.horizontal);
     auto& inlineItems = formattingState().inlineItems();
-    lineLayout(inlineItems, { 0, inlineItems.size() }, constraints);
+    lineLayout(inlineItems, { lineLayoutStart ? lineLayoutStart->inlineItemIndex : 0, inlineItems.size() }, constraints, lineLayoutStart);
 }
 
 LayoutUnit InlineFormattingContext::usedContentHeight() const
@@ -172,17 +175,22 @@ LayoutUnit InlineFormattingContext::usedContentHeight() const
     return bottom - top;
 }
 
-void InlineFormattingContext::lineLayout(InlineItems& inlineItems, LineBuilder::InlineItemRange needsLayoutRange, const ConstraintsForInFlowContent& constraints)
+void InlineFormattingContext::lineLayout(InlineItems& inlineItems, LineBuilder::InlineItemRange needsLayoutRange, const ConstraintsForInFlowContent& constraints, Optional<InlineLineLayoutStart> resumedLineLayoutStart)
 {
     auto& formattingState = this->formattingState();
-    formattingState.lineRuns().reserveInitialCapacity(formattingState.inlineItems().size());
-    InlineLayoutUnit lineLogicalTop = constraints.vertical.logicalTop;
+    formattingState.lineRuns().reserveCapacity(formattingState.inlineItems().size());
+    InlineLayoutUnit lineLogicalTop = resumedLineLayoutStart ? resumedLineLayoutStart->lineLogicalTop : InlineLayoutUnit { constraints.vertical.logicalTop };
     struct PreviousLine {
         LineBuilder::InlineItemRange range;
         size_t overflowContentLength { 0 };
         Optional<InlineLayoutUnit> overflowLogicalWidth;
     };
     Optional<PreviousLine> previousLine;
+    if (resumedLineLayoutStart) {
+        // Pick up the overflow content of the line we are resuming after (see needsLayoutRange.start adjustment below).
+        auto previousLineEnd = resumedLineLayoutStart->inlineItemIndex + (resumedLineLayoutStart->partialLeadingContentLength ? 1 : 0);
+        previousLine = PreviousLine { { resumedLineLayoutStart->inlineItemIndex, previousLineEnd }, resumedLineLayoutStart->partialLeadingContentLength, resumedLineLayoutStart->leadingLogicalWidth };
+    }
     auto& floatingState = formattingState.floatingState();
     auto floatingContext = FloatingContext { *this, floatingState };
     auto isFirstLine = formattingState.lines().isEmpty();
@@ -194,6 +202,7 @@ void InlineFormattingContext::lineLayout(InlineItems& inlineItems, LineBuilder::
         auto partialLeadingContentLength = previousLine ? previousLine->overflowContentLength : 0;
         auto leadingLogicalWidth = previousLine ? previousLine->overflowLogicalWidth : WTF::nullopt;
         auto initialLineConstraints = InlineRect { lineLogicalTop, constraints.horizontal.logicalLeft, constraints.horizontal.logicalWidth, quirks().initialLineHeight() };
+        formattingState.addLineLayoutStart({ needsLayoutRange.start, partialLeadingContentLength, leadingLogicalWidth, lineLogicalTop, formattingState.lineRuns().size() });
         auto lineContent = lineBuilder.layoutInlineContent(needsLayoutRange, partialLeadingContentLength, leadingLogicalWidth, initialLineConstraints, isFirstLine);
         auto lineLogicalRect = computeGeometryForLineContent(lineContent, constraints.horizontal);
 
@@ -572,6 +581,48 @@ void InlineFormattingContext::invalidateFormattingState(const InvalidationState&
     // FIXME: This is also where we would delete inline items if their content changed.
 }
 
+Optional<InlineLineLayoutStart> InlineFormattingContext::invalidateLinesWithDamagedContent(const ConstraintsForInFlowContent& constraints)
+{
+    // When the content of some text boxes is the only thing that changed since the previous line layout (e.g. text appended to a log),
+    // the lines in front of the damaged content stay valid and line layout can resume right before the damage.
+    auto& formattingState = this->formattingState();
+    auto firstDamagedInlineItemIndex = formattingState.firstDamagedInlineItemIndex();
+    if (!firstDamagedInlineItemIndex)
+        return { };
+
+    auto& previousHorizontalConstraints = formattingState.lineLayoutHorizontalConstraints();
+    if (!previousHorizontalConstraints || previousHorizontalConstraints->logicalLeft != constraints.horizontal.logicalLeft || previousHorizontalConstraints->logicalWidth != constraints.horizontal.logicalWidth)
+        return { };
+    auto& lineLayoutStarts = formattingState.lineLayoutStarts();
+    if (lineLayoutStarts.isEmpty() || lineLayoutStarts.first().lineLogicalTop != InlineLayoutUnit { constraints.vertical.logicalTop })
+        return { };
+    // Floats may intrude any line and inline boxes stretch their geometries across lines. Let's keep resuming to plain text content.
+    if (!formattingState.floatingState().floats().isEmpty())
+        return { };
+    for (auto& inlineItem : formattingState.inlineItems()) {
+        if (!inlineItem.isText() && !inlineItem.isLineBreak() && !inlineItem.isWordBreakOpportunity())
+            return { };
+    }
+
+    // The damaged content can't show up on a line in front of the last line that starts before the damage, but the line break
+    // position of the line preceding it may have been decided by looking at the content that follows it.
+    auto firstLineAtDamage = std::lower_bound(lineLayoutStarts.begin(), lineLayoutStarts.end(), *firstDamagedInlineItemIndex, [](auto& lineLayoutStart, auto inlineItemIndex) {
+        return lineLayoutStart.inlineItemIndex < inlineItemIndex;
+    }) - lineLayoutStarts.begin();
+    if (firstLineAtDamage < 2)
+        return { };
+    auto lineIndex = static_cast<size_t>(firstLineAtDamage - 2);
+    // Lines starting with the overflow content of the previous line can't be laid out on their own.
+    while (lineIndex && lineLayoutStarts[lineIndex].partialLeadingContentLength)
+        --lineIndex;
+    if (!lineIndex)
+        return { };
+
+    auto lineLayoutStart = lineLayoutStarts[lineIndex];
+    formattingState.removeLinesAndRunsFrom(lineIndex);
+    return lineLayoutStart;
+}
+
 }
 }
 
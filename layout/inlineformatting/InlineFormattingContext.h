@@ -36,6 +36,7 @@ namespace Layout {
 
 class InlineFormattingState;
 class InvalidationState;
+struct InlineLineLayoutStart;
 class LineBox;
 
 // This class implements the layout logic for inline formatting contexts.
@@ -87,7 +88,7 @@ private:
     };
     InlineFormattingContext::Geometry geometry() const { return Geometry(*this); }
 
-    void lineLayout(InlineItems&, LineBuilder::InlineItemRange, const ConstraintsForInFlowContent&);
+    void lineLayout(InlineItems&, LineBuilder::InlineItemRange, const ConstraintsForInFlowContent&, Optional<InlineLineLayoutStart> resumedLineLayoutStart);
 
     void computeIntrinsicWidthForFormattingRoot(const Box&);
     InlineLayoutUnit computedIntrinsicWidthForConstraint(InlineLayoutUnit availableWidth) const;
@@ -99,6 +100,7 @@ private:
     void collectInlineContentIfNeeded();
     InlineRect computeGeometryForLineContent(const LineBuilder::LineContent&, const HorizontalConstraints&);
     void invalidateFormattingState(const InvalidationState&);
+    Optional<InlineLineLayoutStart> invalidateLinesWithDamagedContent(const ConstraintsForInFlowContent&);
 };
 
 inline InlineFormattingContext::Geometry::Geometry(const InlineFormattingContext& inlineFormattingContext)
@@ -42,6 +42,16 @@ using InlineLines = Vector<InlineLineGeometry, 10>;
 using InlineLineBoxes = Vector<LineBox, 10>;
 using InlineLineRuns = Vector<LineRun>;
 
+// Where line layout started a line. Line layout can resume here when only content after this point has changed.
+struct InlineLineLayoutStart {
+    size_t inlineItemIndex { 0 };
+    size_t partialLeadingContentLength { 0 };
+    Optional<InlineLayoutUnit> leadingLogicalWidth;
+    InlineLayoutUnit lineLogicalTop { 0 };
+    size_t firstLineRunIndex { 0 };
+};
+using InlineLineLayoutStarts = Vector<InlineLineLayoutStart, 10>;
+
 // InlineFormattingState holds the state for a particular inline formatting context tree.
 class InlineFormattingState : public FormattingState {
     WTF_MAKE_ISO_ALLOCATED(InlineFormattingState);
@@ -64,10 +74,21 @@ public:
     InlineLineRuns& lineRuns() { return m_lineRuns; }
     void addLineRun(LineRun&& run) { m_lineRuns.append(WTFMove(run)); }
 
+    const InlineLineLayoutStarts& lineLayoutStarts() const { return m_lineLayoutStarts; }
+    void addLineLayoutStart(const InlineLineLayoutStart& lineLayoutStart) { m_lineLayoutStarts.append(lineLayoutStart); }
+
+    // Set when the content of some inline items changed after line layout but the rest of the inline content (and its geometry) did not.
+    Optional<size_t> firstDamagedInlineItemIndex() const { return m_firstDamagedInlineItemIndex; }
+    void setFirstDamagedInlineItemIndex(size_t);
+
+    const Optional<HorizontalConstraints>& lineLayoutHorizontalConstraints() const { return m_lineLayoutHorizontalConstraints; }
+    void setLineLayoutHorizontalConstraints(const HorizontalConstraints& horizontalConstraints) { m_lineLayoutHorizontalConstraints = horizontalConstraints; }
+
     void setClearGapAfterLastLine(InlineLayoutUnit verticalGap);
     InlineLayoutUnit clearGapAfterLastLine() const { return m_clearGapAfterLastLine; }
 
     void clearLineAndRuns();
+    void removeLinesAndRunsFrom(size_t lineIndex);
     void shrinkToFit();
 
 private:
@@ -76,9 +97,19 @@ private:
     InlineLines m_lines;
     InlineLineBoxes m_lineBoxes;
     InlineLineRuns m_lineRuns;
+    InlineLineLayoutStarts m_lineLayoutStarts;
+    Optional<size_t> m_firstDamagedInlineItemIndex;
+    Optional<HorizontalConstraints> m_lineLayoutHorizontalConstraints;
     InlineLayoutUnit m_clearGapAfterLastLine { 0 };
 };
 
+inline void InlineFormattingState::setFirstDamagedInlineItemIndex(size_t inlineItemIndex)
+{
+    if (m_firstDamagedInlineItemIndex && *m_firstDamagedInlineItemIndex <= inlineItemIndex)
+        return;
+    m_firstDamagedInlineItemIndex = inlineItemIndex;
+}
+
 inline void InlineFormattingState::setClearGapAfterLastLine(InlineLayoutUnit verticalGap)
 {
     ASSERT(verticalGap >= 0);
@@ -90,6 +121,20 @@ inline void InlineFormattingState::clearLineAndRuns()
     m_lines.clear();
     m_lineBoxes.clear();
     m_lineRuns.clear();
+    m_lineLayoutStarts.clear();
+    m_firstDamagedInlineItemIndex = { };
+    m_lineLayoutHorizontalConstraints = { };
+    m_clearGapAfterLastLine = { };
+}
+
+inline void InlineFormattingState::removeLinesAndRunsFrom(size_t lineIndex)
+{
+    ASSERT(lineIndex < m_lines.size());
+    m_lineRuns.shrink(m_lineLayoutStarts[lineIndex].firstLineRunIndex);
+    m_lines.shrink(lineIndex);
+    m_lineBoxes.shrink(lineIndex);
+    m_lineLayoutStarts.shrink(lineIndex);
+    m_firstDamagedInlineItemIndex = { };
     m_clearGapAfterLastLine = { };
 }
 
@@ -98,6 +143,7 @@ inline void InlineFormattingState::shrinkToFit()
     m_lines.shrinkToFit();
     m_lineBoxes.shrinkToFit();
     m_lineRuns.shrinkToFit();
+    m_lineLayoutStarts.shrinkToFit();
 }
 
 }
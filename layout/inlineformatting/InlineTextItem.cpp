@@ -82,6 +82,11 @@ void InlineTextItem::createAndAppendTextItems(InlineItems& inlineContent, const
             return { };
         return TextUtil::width(inlineTextBox, startPosition, startPosition + length, { });
     };
+    // Non-whitespace content has no tab characters, so its width does not depend on where it ends up on the line.
+    // Measure it here once (even on the complex text path) instead of at every line breaking and intrinsic width pass.
+    auto nonWhitespaceItemWidth = [&](auto startPosition, auto length) -> Optional<InlineLayoutUnit> {
+        return TextUtil::width(inlineTextBox, startPosition, startPosition + length, { });
+    };
 
     while (currentPosition < text.length()) {
         auto isSegmentBreakCandidate = [](auto character) {
@@ -97,7 +102,8 @@ void InlineTextItem::createAndAppendTextItems(InlineItems& inlineContent, const
 
         if (isWhitespaceCharacter(text[currentPosition], style.preserveNewline())) {
             auto appendWhitespaceItem = [&] (auto startPosition, auto itemLength) {
-                auto simpleSingleWhitespaceContent = inlineTextBox.canUseSimplifiedContentMeasuring() && (itemLength == 1 || whitespaceContentIsTreatedAsSingleSpace);
+                // Collapsible whitespace always measures as a single space, regardless of the text measuring path.
+                auto simpleSingleWhitespaceContent = whitespaceContentIsTreatedAsSingleSpace || (inlineTextBox.canUseSimplifiedContentMeasuring() && itemLength == 1);
                 auto width = simpleSingleWhitespaceContent ? makeOptional(InlineLayoutUnit { font.spaceWidth() }) : inlineItemWidth(startPosition, itemLength);
                 auto isWordSeparator = [&] {
                     if (whitespaceContentIsTreatedAsSingleSpace)
@@ -153,7 +159,7 @@ void InlineTextItem::createAndAppendTextItems(InlineItems& inlineContent, const
         ASSERT(initialNonWhitespacePosition < currentPosition);
         ASSERT_IMPLIES(style.hyphens() == Hyphens::None, !hasTrailingSoftHyphen);
         auto length = currentPosition - initialNonWhitespacePosition;
-        inlineContent.append(InlineTextItem::createNonWhitespaceItem(inlineTextBox, initialNonWhitespacePosition, length, hasTrailingSoftHyphen, inlineItemWidth(initialNonWhitespacePosition, length)));
+        inlineContent.append(InlineTextItem::createNonWhitespaceItem(inlineTextBox, initialNonWhitespacePosition, length, hasTrailingSoftHyphen, nonWhitespaceItemWidth(initialNonWhitespacePosition, length)));
     }
 }
 
@@ -43,6 +43,7 @@
 #include "Settings.h"
 #include <pal/Logging.h>
 #include <wtf/OptionSet.h>
+#include <wtf/text/TextStream.h>
 
 #if ENABLE(LAYOUT_FORMATTING_CONTEXT)
 
@@ -51,38 +52,21 @@
 #define ALLOW_INLINE_BLOCK 1
 #define ALLOW_INLINES 0
 
-#ifndef NDEBUG
 #define SET_REASON_AND_RETURN_IF_NEEDED(reason, reasons, includeReasons) { \
         reasons.add(AvoidanceReason::reason); \
         if (includeReasons == IncludeReasons::First) \
             return reasons; \
     }
-#else
-#define SET_REASON_AND_RETURN_IF_NEEDED(reason, reasons, includeReasons) { \
-        ASSERT_UNUSED(includeReasons, includeReasons == IncludeReasons::First); \
-        reasons.add(AvoidanceReason::reason); \
-        return reasons; \
-    }
-#endif
 
-#ifndef NDEBUG
 #define ADD_REASONS_AND_RETURN_IF_NEEDED(newReasons, reasons, includeReasons) { \
         reasons.add(newReasons); \
         if (includeReasons == IncludeReasons::First) \
             return reasons; \
     }
-#else
-#define ADD_REASONS_AND_RETURN_IF_NEEDED(newReasons, reasons, includeReasons) { \
-        ASSERT_UNUSED(includeReasons, includeReasons == IncludeReasons::First); \
-        reasons.add(newReasons); \
-        return reasons; \
-    }
-#endif
 
 namespace WebCore {
 namespace LayoutIntegration {
 
-#ifndef NDEBUG
 static void printReason(AvoidanceReason reason, TextStream& stream)
 {
     switch (reason) {
@@ -209,9 +193,6 @@ static void printReason(AvoidanceReason reason, TextStream& stream)
     case AvoidanceReason::FlowHasComplexFontCodePath:
         stream << "text with complex font codepath";
         break;
-    case AvoidanceReason::FlowHasTextShadow:
-        stream << "text-shadow";
-        break;
     case AvoidanceReason::FlowChildIsSelected:
         stream << "selected content";
         break;
@@ -244,6 +225,13 @@ static void printReason(AvoidanceReason reason, TextStream& stream)
     }
 }
 
+TextStream& operator<<(TextStream& stream, AvoidanceReason reason)
+{
+    printReason(reason, stream);
+    return stream;
+}
+
+#ifndef NDEBUG
 static void printReasons(OptionSet<AvoidanceReason> reasons, TextStream& stream)
 {
     stream << " ";
@@ -271,6 +259,8 @@ static void printTextForSubtree(const RenderObject& renderer, unsigned& characte
         printTextForSubtree(*child, charactersLeft, stream);
 }
 
+#endif
+
 static unsigned textLengthForSubtree(const RenderObject& renderer)
 {
     if (is<RenderText>(renderer))
@@ -303,6 +293,7 @@ static void collectNonEmptyLeafRenderBlockFlows(const RenderObject& renderer, Ha
         collectNonEmptyLeafRenderBlockFlows(*child, leafRenderers);
 }
 
+#ifndef NDEBUG
 static void collectNonEmptyLeafRenderBlockFlowsForCurrentPage(HashSet<const RenderBlockFlow*>& leafRenderers)
 {
     for (const auto* document : Document::allDocuments()) {
@@ -468,43 +459,57 @@ static OptionSet<AvoidanceReason> canUseForText(StringView text, const FontCasca
     return canUseForText(text.characters16(), text.length(), fontCascade, lineHeightConstraint, textIsJustified, includeReasons);
 }
 
-static OptionSet<AvoidanceReason> canUseForFontAndText(const RenderBoxModelObject& container, IncludeReasons includeReasons)
+static Optional<float> lineHeightConstraintForContainer(const RenderBoxModelObject& container)
+{
+    if (!container.style().lineBoxContain().contains(LineBoxContain::Glyphs))
+        return WTF::nullopt;
+    return container.lineHeight(false, HorizontalLine, PositionOfInteriorLineBoxes).toFloat();
+}
+
+static OptionSet<AvoidanceReason> canUseForTextRenderer(const RenderText& textRenderer, const RenderBoxModelObject& container, Optional<float> lineHeightConstraint, IncludeReasons includeReasons)
 {
     OptionSet<AvoidanceReason> reasons;
-    // We assume that all lines have metrics based purely on the primary font.
     const auto& style = container.style();
     auto& fontCascade = style.fontCascade();
-    if (fontCascade.primaryFont().isInterstitial())
-        SET_REASON_AND_RETURN_IF_NEEDED(FlowIsMissingPrimaryFont, reasons, includeReasons);
-    Optional<float> lineHeightConstraint;
-    if (style.lineBoxContain().contains(LineBoxContain::Glyphs))
-        lineHeightConstraint = container.lineHeight(false, HorizontalLine, PositionOfInteriorLineBoxes).toFloat();
     bool flowIsJustified = style.textAlign() == TextAlignMode::Justify;
-    for (const auto& textRenderer : childrenOfType<RenderText>(container)) {
-        // FIXME: Do not return until after checking all children.
-        if (textRenderer.isCombineText())
-            SET_REASON_AND_RETURN_IF_NEEDED(FlowTextIsCombineText, reasons, includeReasons);
-        if (textRenderer.isCounter())
-            SET_REASON_AND_RETURN_IF_NEEDED(FlowTextIsRenderCounter, reasons, includeReasons);
-        if (textRenderer.isQuote())
-            SET_REASON_AND_RETURN_IF_NEEDED(FlowTextIsRenderQuote, reasons, includeReasons);
-        if (textRenderer.isTextFragment())
-            SET_REASON_AND_RETURN_IF_NEEDED(FlowTextIsTextFragment, reasons, includeReasons);
-        if (textRenderer.isSVGInlineText())
-            SET_REASON_AND_RETURN_IF_NEEDED(FlowTextIsSVGInlineText, reasons, includeReasons);
-        if (!textRenderer.canUseSimpleFontCodePath()) {
-            // No need to check the code path at this point. We already know it can't be simple.
+    if (textRenderer.isCombineText())
+        SET_REASON_AND_RETURN_IF_NEEDED(FlowTextIsCombineText, reasons, includeReasons);
+    if (textRenderer.isCounter())
+        SET_REASON_AND_RETURN_IF_NEEDED(FlowTextIsRenderCounter, reasons, includeReasons);
+    if (textRenderer.isQuote())
+        SET_REASON_AND_RETURN_IF_NEEDED(FlowTextIsRenderQuote, reasons, includeReasons);
+    if (textRenderer.isTextFragment())
+        SET_REASON_AND_RETURN_IF_NEEDED(FlowTextIsTextFragment, reasons, includeReasons);
+    if (textRenderer.isSVGInlineText())
+        SET_REASON_AND_RETURN_IF_NEEDED(FlowTextIsSVGInlineText, reasons, includeReasons);
+    if (!textRenderer.canUseSimpleFontCodePath()) {
+        // No need to check the code path at this point. We already know it can't be simple.
+        SET_REASON_AND_RETURN_IF_NEEDED(FlowHasComplexFontCodePath, reasons, includeReasons);
+    } else {
+        WebCore::TextRun run(String(textRenderer.text()));
+        run.setCharacterScanForCodePath(false);
+        if (fontCascade.codePath(run) != FontCascade::CodePath::Simple)
             SET_REASON_AND_RETURN_IF_NEEDED(FlowHasComplexFontCodePath, reasons, includeReasons);
-        } else {
-            WebCore::TextRun run(String(textRenderer.text()));
-            run.setCharacterScanForCodePath(false);
-            if (style.fontCascade().codePath(run) != FontCascade::CodePath::Simple)
-                SET_REASON_AND_RETURN_IF_NEEDED(FlowHasComplexFontCodePath, reasons, includeReasons);
-        }
+    }
 
-        auto textReasons = canUseForText(textRenderer.stringView(), fontCascade, lineHeightConstraint, flowIsJustified, includeReasons);
-        if (textReasons)
-            ADD_REASONS_AND_RETURN_IF_NEEDED(textReasons, reasons, includeReasons);
+    auto textReasons = canUseForText(textRenderer.stringView(), fontCascade, lineHeightConstraint, flowIsJustified, includeReasons);
+    if (textReasons)
+        ADD_REASONS_AND_RETURN_IF_NEEDED(textReasons, reasons, includeReasons);
+    return reasons;
+}
+
+static OptionSet<AvoidanceReason> canUseForFontAndText(const RenderBoxModelObject& container, IncludeReasons includeReasons)
+{
+    OptionSet<AvoidanceReason> reasons;
+    // We assume that all lines have metrics based purely on the primary font.
+    if (container.style().fontCascade().primaryFont().isInterstitial())
+        SET_REASON_AND_RETURN_IF_NEEDED(FlowIsMissingPrimaryFont, reasons, includeReasons);
+    auto lineHeightConstraint = lineHeightConstraintForContainer(container);
+    for (const auto& textRenderer : childrenOfType<RenderText>(container)) {
+        // FIXME: Do not return until after checking all children.
+        auto textRendererReasons = canUseForTextRenderer(textRenderer, container, lineHeightConstraint, includeReasons);
+        if (textRendererReasons)
+            ADD_REASONS_AND_RETURN_IF_NEEDED(textRendererReasons, reasons, includeReasons);
     }
     return reasons;
 }
@@ -535,8 +540,6 @@ static OptionSet<AvoidanceReason> canUseForStyle(const RenderStyle& style, Inclu
         SET_REASON_AND_RETURN_IF_NEEDED(FlowHasLineSnap, reasons, includeReasons);
     if (style.textEmphasisFill() != TextEmphasisFill::Filled || style.textEmphasisMark() != TextEmphasisMark::None)
         SET_REASON_AND_RETURN_IF_NEEDED(FlowHasTextEmphasisFillOrMark, reasons, includeReasons);
-    if (style.textShadow())
-        SET_REASON_AND_RETURN_IF_NEEDED(FlowHasTextShadow, reasons, includeReasons);
     if (style.hasPseudoStyle(PseudoId::FirstLine))
         SET_REASON_AND_RETURN_IF_NEEDED(FlowHasPseudoFirstLine, reasons, includeReasons);
     if (style.hasPseudoStyle(PseudoId::FirstLetter))
@@ -779,6 +782,51 @@ bool canUseForLineLayout(const RenderBlockFlow& flow)
     return canUseForLineLayoutWithReason(flow, IncludeReasons::First).isEmpty();
 }
 
+Vector<AvoidanceReasonStatistics> collectAvoidanceReasonStatistics(const Document& document)
+{
+    Vector<AvoidanceReasonStatistics> statistics;
+    if (!document.renderView())
+        return statistics;
+
+    HashSet<const RenderBlockFlow*> leafRenderers;
+    collectNonEmptyLeafRenderBlockFlows(*document.renderView(), leafRenderers);
+    for (const auto* flow : leafRenderers) {
+        auto reasons = canUseForLineLayoutWithReason(*flow, IncludeReasons::All);
+        if (reasons.isEmpty())
+            continue;
+        auto lineCount = static_cast<unsigned>(std::max(flow->lineCount(), 0));
+        auto textLength = textLengthForSubtree(*flow);
+        for (auto reason : reasons) {
+            auto index = statistics.findMatching([&](auto& entry) {
+                return entry.reason == reason;
+            });
+            if (index == notFound) {
+                statistics.append({ reason });
+                index = statistics.size() - 1;
+            }
+            auto& entry = statistics[index];
+            ++entry.blockCount;
+            entry.lineCount += lineCount;
+            entry.textLength += textLength;
+        }
+    }
+    std::sort(statistics.begin(), statistics.end(), [](auto& a, auto& b) {
+        return static_cast<uint64_t>(a.reason) < static_cast<uint64_t>(b.reason);
+    });
+    return statistics;
+}
+
+bool canUseForLineLayoutAfterTextContentChange(const RenderBlockFlow& flow, const RenderText& textRenderer)
+{
+    // Only the content of this renderer changed, the rest of the block container was checked when its line layout was set up.
+    // Text is checked against the block container style, which only holds while text can't be nested in inline boxes.
+    static_assert(!ALLOW_INLINES, "Check the text renderer against its parent style once inline boxes are supported");
+    ASSERT(textRenderer.parent() == &flow);
+    if (!canUseForChild(textRenderer, IncludeReasons::First).isEmpty())
+        return false;
+    return canUseForTextRenderer(textRenderer, flow, lineHeightConstraintForContainer(flow), IncludeReasons::First).isEmpty();
+}
+
 bool canUseForLineLayoutAfterStyleChange(const RenderBlockFlow& blockContainer, StyleDifference diff)
 {
     switch (diff) {
@@ -30,9 +30,15 @@
 #include "RenderStyleConstants.h"
 #include <wtf/Forward.h>
 
+namespace WTF {
+class TextStream;
+}
+
 namespace WebCore {
 
+class Document;
 class RenderBlockFlow;
+class RenderText;
 
 namespace LayoutIntegration {
 
@@ -60,44 +66,56 @@ enum class AvoidanceReason : uint64_t {
     FlowHasLineAlignEdges                        = 1LLU  << 20,
     FlowHasLineSnap                              = 1LLU  << 21,
     FlowHasTextEmphasisFillOrMark                = 1LLU  << 22,
-    FlowHasTextShadow                            = 1LLU  << 23,
-    FlowHasPseudoFirstLine                       = 1LLU  << 24,
-    FlowHasPseudoFirstLetter                     = 1LLU  << 25,
-    FlowHasTextCombine                           = 1LLU  << 26,
-    FlowHasTextFillBox                           = 1LLU  << 27,
-    FlowHasBorderFitLines                        = 1LLU  << 28,
-    FlowHasNonAutoLineBreak                      = 1LLU  << 29,
-    FlowHasTextSecurity                          = 1LLU  << 30,
-    FlowHasSVGFont                               = 1LLU  << 31,
-    FlowTextHasDirectionCharacter                = 1LLU  << 32,
-    FlowIsMissingPrimaryFont                     = 1LLU  << 33,
-    FlowPrimaryFontIsInsufficient                = 1LLU  << 34,
-    FlowTextIsCombineText                        = 1LLU  << 35,
-    FlowTextIsRenderCounter                      = 1LLU  << 36,
-    FlowTextIsRenderQuote                        = 1LLU  << 37,
-    FlowTextIsTextFragment                       = 1LLU  << 38,
-    FlowTextIsSVGInlineText                      = 1LLU  << 39,
-    FlowHasComplexFontCodePath                   = 1LLU  << 40,
-    FeatureIsDisabled                            = 1LLU  << 41,
-    FlowDoesNotEstablishInlineFormattingContext  = 1LLU  << 42,
-    FlowChildIsSelected                          = 1LLU  << 43,
-    FlowHasHangingPunctuation                    = 1LLU  << 44,
-    FlowFontHasOverflowGlyph                     = 1LLU  << 45,
-    FlowTextHasSurrogatePair                     = 1LLU  << 46,
-    MultiColumnFlowIsNotTopLevel                 = 1LLU  << 47,
-    MultiColumnFlowHasColumnSpanner              = 1LLU  << 48,
-    MultiColumnFlowVerticalAlign                 = 1LLU  << 49,
-    MultiColumnFlowIsFloating                    = 1LLU  << 50,
-    FlowIncludesDocumentMarkers                  = 1LLU  << 51,
-    EndOfReasons                                 = 1LLU  << 52
+    FlowHasPseudoFirstLine                       = 1LLU  << 23,
+    FlowHasPseudoFirstLetter                     = 1LLU  << 24,
+    FlowHasTextCombine                           = 1LLU  << 25,
+    FlowHasTextFillBox                           = 1LLU  << 26,
+    FlowHasBorderFitLines                        = 1LLU  << 27,
+    FlowHasNonAutoLineBreak                      = 1LLU  << 28,
+    FlowHasTextSecurity                          = 1LLU  << 29,
+    FlowHasSVGFont                               = 1LLU  << 30,
+    FlowTextHasDirectionCharacter                = 1LLU  << 31,
+    FlowIsMissingPrimaryFont                     = 1LLU  << 32,
+    FlowPrimaryFontIsInsufficient                = 1LLU  << 33,
+    FlowTextIsCombineText                        = 1LLU  << 34,
+    FlowTextIsRenderCounter                      = 1LLU  << 35,
+    FlowTextIsRenderQuote                        = 1LLU  << 36,
+    FlowTextIsTextFragment                       = 1LLU  << 37,
+    FlowTextIsSVGInlineText                      = 1LLU  << 38,
+    FlowHasComplexFontCodePath                   = 1LLU  << 39,
+    FeatureIsDisabled                            = 1LLU  << 40,
+    FlowDoesNotEstablishInlineFormattingContext  = 1LLU  << 41,
+    FlowChildIsSelected                          = 1LLU  << 42,
+    FlowHasHangingPunctuation                    = 1LLU  << 43,
+    FlowFontHasOverflowGlyph                     = 1LLU  << 44,
+    FlowTextHasSurrogatePair                     = 1LLU  << 45,
+    MultiColumnFlowIsNotTopLevel                 = 1LLU  << 46,
+    MultiColumnFlowHasColumnSpanner              = 1LLU  << 47,
+    MultiColumnFlowVerticalAlign                 = 1LLU  << 48,
+    MultiColumnFlowIsFloating                    = 1LLU  << 49,
+    FlowIncludesDocumentMarkers                  = 1LLU  << 50,
+    EndOfReasons                                 = 1LLU  << 51
 };
 
 bool canUseForLineLayout(const RenderBlockFlow&);
 bool canUseForLineLayoutAfterStyleChange(const RenderBlockFlow&, StyleDifference);
+bool canUseForLineLayoutAfterTextContentChange(const RenderBlockFlow&, const RenderText&);
 
 enum class IncludeReasons { First , All };
 OptionSet<AvoidanceReason> canUseForLineLayoutWithReason(const RenderBlockFlow&, IncludeReasons);
 
+// How much of the document's text content is kept on the legacy line layout path by a particular avoidance reason.
+// Note that release builds only collect the first avoidance reason of each block container.
+struct AvoidanceReasonStatistics {
+    AvoidanceReason reason;
+    unsigned blockCount { 0 };
+    unsigned lineCount { 0 };
+    unsigned textLength { 0 };
+};
+Vector<AvoidanceReasonStatistics> collectAvoidanceReasonStatistics(const Document&);
+
+WTF::TextStream& operator<<(WTF::TextStream&, AvoidanceReason);
+
 }
 }
 
@@ -283,6 +283,18 @@ void InlineContentBuilder::createDisplayLineRuns(const Layout::InlineFormattingS
                 // Last letter's negative spacing shrinks logical rect. Push it to ink overflow.
                 inkOverflow.expand(-letterSpacing, { });
             }
+            if (style.textShadow()) {
+                LayoutUnit shadowTop;
+                LayoutUnit shadowBottom;
+                LayoutUnit shadowLeft;
+                LayoutUnit shadowRight;
+                style.getTextShadowBlockDirectionExtent(shadowTop, shadowBottom);
+                style.getTextShadowInlineDirectionExtent(shadowLeft, shadowRight);
+                inkOverflow.shiftXEdgeTo(inkOverflow.x() + shadowLeft);
+                inkOverflow.shiftMaxXEdgeTo(inkOverflow.maxX() + shadowRight);
+                inkOverflow.shiftYEdgeTo(inkOverflow.y() + shadowTop);
+                inkOverflow.shiftMaxYEdgeTo(inkOverflow.maxY() + shadowBottom);
+            }
             return inkOverflow;
         };
         RELEASE_ASSERT(startOffset >= text->start() && startOffset < text->end());
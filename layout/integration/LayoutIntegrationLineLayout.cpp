@@ -35,8 +35,10 @@
 #include "HitTestResult.h"
 #include "InlineFormattingContext.h"
 #include "InlineFormattingState.h"
+#include "InlineTextItem.h"
 #include "InvalidationState.h"
 #include "LayoutBoxGeometry.h"
+#include "LayoutInlineTextBox.h"
 #include "LayoutIntegrationCoverage.h"
 #include "LayoutIntegrationInlineContentBuilder.h"
 #include "LayoutIntegrationPagination.h"
@@ -49,6 +51,7 @@
 #include "RenderImage.h"
 #include "RenderInline.h"
 #include "RenderLineBreak.h"
+#include "RenderText.h"
 #include "RenderView.h"
 #include "RuntimeEnabledFeatures.h"
 #include "Settings.h"
@@ -119,6 +122,12 @@ bool LineLayout::canUseForAfterStyleChange(const RenderBlockFlow& flow, StyleDif
     return canUseForLineLayoutAfterStyleChange(flow, diff);
 }
 
+bool LineLayout::canUseForAfterTextContentChange(const RenderBlockFlow& flow, const RenderText& textRenderer)
+{
+    ASSERT(isEnabled());
+    return canUseForLineLayoutAfterTextContentChange(flow, textRenderer);
+}
+
 void LineLayout::updateReplacedDimensions(const RenderBox& replaced)
 {
     updateLayoutBoxDimensions(replaced);
@@ -182,6 +191,53 @@ void LineLayout::updateInlineBoxDimensions(const RenderInline& renderInline)
 void LineLayout::updateStyle(const RenderBoxModelObject& renderer)
 {
     m_boxTree.updateStyle(renderer);
+    // Style changes may affect any line.
+    m_inlineFormattingState.clearLineAndRuns();
+}
+
+void LineLayout::updateTextContent(const RenderText& textRenderer)
+{
+    auto& inlineTextBox = downcast<Layout::InlineTextBox>(m_boxTree.layoutBoxForRenderer(textRenderer));
+    auto oldContent = inlineTextBox.content();
+    auto newContent = textRenderer.text();
+    inlineTextBox.setContent(newContent, textRenderer.canUseSimplifiedTextMeasuring());
+
+    auto& inlineItems = m_inlineFormattingState.inlineItems();
+    if (inlineItems.isEmpty())
+        return;
+    // Replace the inline items of this text box only and let line layout resume at the damaged line.
+    auto firstInlineItemIndex = inlineItems.findMatching([&](auto& inlineItem) {
+        return &inlineItem.layoutBox() == &inlineTextBox;
+    });
+    if (firstInlineItemIndex == notFound) {
+        releaseInlineItemCache();
+        return;
+    }
+    auto endInlineItemIndex = firstInlineItemIndex + 1;
+    while (endInlineItemIndex < inlineItems.size() && &inlineItems[endInlineItemIndex].layoutBox() == &inlineTextBox)
+        ++endInlineItemIndex;
+
+    auto textItems = Layout::InlineItems { };
+    Layout::InlineTextItem::createAndAppendTextItems(textItems, inlineTextBox);
+    inlineItems.remove(firstInlineItemIndex, endInlineItemIndex - firstInlineItemIndex);
+    inlineItems.insertVector(firstInlineItemIndex, textItems);
+
+    // Lines in front of the first changed character are kept. The character preceding it is included too,
+    // since the text item ending there may now be joined with the new content (e.g. appending to a word).
+    unsigned commonPrefixLength = 0;
+    auto commonLength = std::min(oldContent.length(), newContent.length());
+    while (commonPrefixLength < commonLength && oldContent[commonPrefixLength] == newContent[commonPrefixLength])
+        ++commonPrefixLength;
+    auto damagedPosition = commonPrefixLength ? commonPrefixLength - 1 : 0;
+
+    auto damagedTextItemIndex = textItems.findMatching([&](auto& textItem) {
+        return is<Layout::InlineTextItem>(textItem) && downcast<Layout::InlineTextItem>(textItem).end() > damagedPosition;
+    });
+    // Content was removed from the end of the text box.
+    if (damagedTextItemIndex == notFound)
+        damagedTextItemIndex = textItems.isEmpty() ? 0 : textItems.size() - 1;
+    auto damagedInlineItemIndex = firstInlineItemIndex + damagedTextItemIndex;
+    m_inlineFormattingState.setFirstDamagedInlineItemIndex(damagedInlineItemIndex);
 }
 
 void LineLayout::layout()
@@ -475,6 +531,10 @@ void LineLayout::paint(PaintInfo& paintInfo, const LayoutPoint& paintOffset)
         TextPainter textPainter(paintInfo.context());
         textPainter.setFont(fontCascade);
         textPainter.setStyle(computeTextPaintStyle(flow().frame(), style, paintInfo));
+        auto* textShadow = paintInfo.forceTextColor() ? nullptr : style.textShadow();
+        textPainter.setShadow(textShadow);
+        if (style.hasAppleColorFilter())
+            textPainter.setShadowColorFilter(&style.appleColorFilter());
         textPainter.setGlyphDisplayListIfNeeded(run, paintInfo, fontCascade, paintInfo.context(), textRun);
 
         auto textOrigin = FloatPoint { paintOffset.x() + rect.x(), roundToDevicePixel(paintOffset.y() + rect.y() + fontCascade.fontMetrics().ascent(), deviceScaleFactor) };
@@ -484,6 +544,9 @@ void LineLayout::paint(PaintInfo& paintInfo, const LayoutPoint& paintOffset)
             auto& textRenderer = downcast<RenderText>(m_boxTree.rendererForLayoutBox(run.layoutBox()));
             auto painter = TextDecorationPainter { paintInfo.context(), style.textDecorationsInEffect(), textRenderer, false, fontCascade };
             painter.setWidth(rect.width());
+            painter.setTextShadow(textShadow);
+            if (style.hasAppleColorFilter())
+                painter.setShadowColorFilter(&style.appleColorFilter());
             painter.paintTextDecoration(textRun, textOrigin, rect.location() + paintOffset);
         }
     }
@@ -549,6 +612,7 @@ void LineLayout::releaseCaches(RenderView& view)
 void LineLayout::releaseInlineItemCache()
 {
     m_inlineFormattingState.inlineItems().clear();
+    m_inlineFormattingState.clearLineAndRuns();
 }
 
 #if ENABLE(TREE_DEBUGGING)
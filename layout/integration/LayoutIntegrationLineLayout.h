@@ -46,6 +46,7 @@ class RenderBox;
 class RenderBoxModelObject;
 class RenderInline;
 class RenderLineBreak;
+class RenderText;
 struct PaintInfo;
 
 namespace LayoutIntegration {
@@ -65,12 +66,14 @@ public:
     static bool isEnabled();
     static bool canUseFor(const RenderBlockFlow&);
     static bool canUseForAfterStyleChange(const RenderBlockFlow&, StyleDifference);
+    static bool canUseForAfterTextContentChange(const RenderBlockFlow&, const RenderText&);
 
     void updateReplacedDimensions(const RenderBox&);
     void updateInlineBlockDimensions(const RenderBlock&);
     void updateLineBreakBoxDimensions(const RenderLineBreak&);
     void updateInlineBoxDimensions(const RenderInline&);
     void updateStyle(const RenderBoxModelObject&);
+    void updateTextContent(const RenderText&);
     void layout();
 
     LayoutUnit contentLogicalHeight() const;
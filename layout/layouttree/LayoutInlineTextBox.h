@@ -41,6 +41,7 @@ public:
     virtual ~InlineTextBox() = default;
 
     String content() const { return m_content; }
+    void setContent(String, bool canUseSimplifiedContentMeasuring);
     // FIXME: This should not be a box's property.
     bool canUseSimplifiedContentMeasuring() const { return m_canUseSimplifiedContentMeasuring; }
 
@@ -49,6 +50,12 @@ private:
     bool m_canUseSimplifiedContentMeasuring { false };
 };
 
+inline void InlineTextBox::setContent(String content, bool canUseSimplifiedContentMeasuring)
+{
+    m_content = content;
+    m_canUseSimplifiedContentMeasuring = canUseSimplifiedContentMeasuring;
+}
+
 }
 }
 
@@ -68,7 +68,7 @@ void FrameViewLayoutContext::layoutUsingFormattingContext()
     m_layoutState = makeUnique<Layout::LayoutState>(*document(), m_layoutTree->root());
     // FIXME: This is not the real invalidation yet.
     auto invalidationState = Layout::InvalidationState { };
-    auto layoutContext = Layout::LayoutContext { *m_layoutState };
+    auto layoutContext = Layout::LayoutContext { *m_layoutState, this };
     layoutContext.layout(view().layoutSize(), invalidationState);
 
     // Clean up the render tree state when we don't run RenderView::layout.
@@ -163,6 +163,7 @@ FrameViewLayoutContext::FrameViewLayoutContext(FrameView& frameView)
 
 FrameViewLayoutContext::~FrameViewLayoutContext()
 {
+    stopTrackingLayoutStatistics();
 }
 
 void FrameViewLayoutContext::layout()
@@ -229,7 +230,13 @@ void FrameViewLayoutContext::layout()
 #ifndef NDEBUG
         RenderTreeNeedsLayoutChecker checker(*layoutRoot);
 #endif
-        layoutRoot->layout();
+        if (UNLIKELY(isTrackingLayoutStatistics())) {
+            auto cause = relayoutCause(*layoutRoot);
+            auto startTime = MonotonicTime::now();
+            layoutRoot->layout();
+            recordLayoutStatistics(layoutRoot->renderName(), cause, MonotonicTime::now() - startTime);
+        } else
+            layoutRoot->layout();
 #if ENABLE(LAYOUT_FORMATTING_CONTEXT)
         layoutUsingFormattingContext();
 #endif
@@ -263,6 +270,59 @@ void FrameViewLayoutContext::layout()
     DebugPageOverlays::didLayout(view().frame());
 }
 
+void FrameViewLayoutContext::startTrackingLayoutStatistics()
+{
+    if (!m_layoutStatistics)
+        ++RenderElement::s_layoutStatisticsTrackingCount;
+    m_layoutStatistics = makeUnique<LayoutStatisticsMap>();
+}
+
+void FrameViewLayoutContext::stopTrackingLayoutStatistics()
+{
+    if (!m_layoutStatistics)
+        return;
+    ASSERT(RenderElement::s_layoutStatisticsTrackingCount);
+    --RenderElement::s_layoutStatisticsTrackingCount;
+    m_layoutStatistics = nullptr;
+}
+
+void FrameViewLayoutContext::recordLayoutStatistics(const char* name, Optional<RelayoutCause> cause, Seconds layoutTime)
+{
+    if (!m_layoutStatistics)
+        return;
+    auto& statistics = m_layoutStatistics->add(String { name }, LayoutStatistics { }).iterator->value;
+    ++statistics.layoutCount;
+    statistics.layoutTime += layoutTime;
+    if (!cause)
+        return;
+    switch (*cause) {
+    case RelayoutCause::SelfNeedsLayout:
+        ++statistics.selfNeedsLayoutCount;
+        break;
+    case RelayoutCause::PositionedMovement:
+        ++statistics.positionedMovementCount;
+        break;
+    case RelayoutCause::ChildNeedsLayout:
+        ++statistics.childNeedsLayoutCount;
+        break;
+    case RelayoutCause::SimplifiedNormalFlow:
+        ++statistics.simplifiedNormalFlowCount;
+        break;
+    }
+}
+
+FrameViewLayoutContext::RelayoutCause FrameViewLayoutContext::relayoutCause(const RenderElement& renderer)
+{
+    // Style, content and size changes all end up marking the renderer itself dirty.
+    if (renderer.selfNeedsLayout())
+        return RelayoutCause::SelfNeedsLayout;
+    if (renderer.needsPositionedMovementLayout())
+        return RelayoutCause::PositionedMovement;
+    if (renderer.normalChildNeedsLayout() || renderer.posChildNeedsLayout())
+        return RelayoutCause::ChildNeedsLayout;
+    return RelayoutCause::SimplifiedNormalFlow;
+}
+
 void FrameViewLayoutContext::runOrScheduleAsynchronousTasks()
 {
     if (m_asynchronousTasksTimer.isActive())
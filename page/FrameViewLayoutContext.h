@@ -27,7 +27,10 @@
 
 #include "LayoutUnit.h"
 #include "Timer.h"
+#include <wtf/HashMap.h>
+#include <wtf/Seconds.h>
 #include <wtf/WeakPtr.h>
+#include <wtf/text/StringHash.h>
 
 namespace WebCore {
 
@@ -87,6 +90,32 @@ public:
 
     unsigned layoutCount() const { return m_layoutCount; }
 
+    // Per renderer type (RenderObject::renderName()) and per formatting context type layout statistics, collected between
+    // startTrackingLayoutStatistics() and stopTrackingLayoutStatistics() (see Internals::layoutStatistics).
+    enum class RelayoutCause : uint8_t {
+        SelfNeedsLayout,
+        PositionedMovement,
+        ChildNeedsLayout,
+        SimplifiedNormalFlow
+    };
+    struct LayoutStatistics {
+        unsigned layoutCount { 0 };
+        // Includes the time spent laying out descendants.
+        Seconds layoutTime;
+        unsigned selfNeedsLayoutCount { 0 };
+        unsigned positionedMovementCount { 0 };
+        unsigned childNeedsLayoutCount { 0 };
+        unsigned simplifiedNormalFlowCount { 0 };
+    };
+    // Keyed on the name contents since the same label can be recorded from different translation units.
+    using LayoutStatisticsMap = HashMap<String, LayoutStatistics>;
+    WEBCORE_EXPORT void startTrackingLayoutStatistics();
+    WEBCORE_EXPORT void stopTrackingLayoutStatistics();
+    bool isTrackingLayoutStatistics() const { return !!m_layoutStatistics; }
+    const LayoutStatisticsMap* layoutStatistics() const { return m_layoutStatistics.get(); }
+    void recordLayoutStatistics(const char* name, Optional<RelayoutCause>, Seconds layoutTime);
+    static RelayoutCause relayoutCause(const RenderElement&);
+
     RenderElement* subtreeLayoutRoot() const;
     void clearSubtreeLayoutRoot() { m_subtreeLayoutRoot.clear(); }
     void convertSubtreeLayoutToFullLayout();
@@ -187,6 +216,7 @@ private:
     int m_layoutDisallowedCount { 0 };
     unsigned m_paintOffsetCacheDisableCount { 0 };
     LayoutStateStack m_layoutStateStack;
+    std::unique_ptr<LayoutStatisticsMap> m_layoutStatistics;
 #if ENABLE(LAYOUT_FORMATTING_CONTEXT)
     std::unique_ptr<Layout::LayoutState> m_layoutState;
     std::unique_ptr<Layout::LayoutTree> m_layoutTree;
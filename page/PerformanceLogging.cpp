@@ -33,9 +33,11 @@
 #include "Frame.h"
 #include "FrameLoader.h"
 #include "FrameLoaderClient.h"
+#include "InlineTextBox.h"
 #include "JSDOMWindow.h"
 #include "Logging.h"
 #include "Page.h"
+#include "RootInlineBox.h"
 
 namespace WebCore {
 
@@ -66,6 +68,8 @@ HashMap<const char*, size_t> PerformanceLogging::memoryUsageStatistics(ShouldInc
     stats.add("backforward_cache_page_count", backForwardCache.pageCount());
 
     stats.add("document_count", Document::allDocuments().size());
+    stats.add("legacy_line_box_count", RootInlineBox::instanceCount());
+    stats.add("legacy_text_box_count", InlineTextBox::instanceCount());
 
     if (includeExpensive == ShouldIncludeExpensiveComputations::Yes) {
         stats.add("javascript_gc_heap_size", vm.heap.size());
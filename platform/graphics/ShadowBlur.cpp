@@ -56,67 +56,76 @@ static inline int roundUpToMultipleOf32(int d)
 
 // ShadowBlur needs a scratch image as the buffer for the blur filter.
 // Instead of creating and destroying the buffer for every operation,
-// we create a buffer which will be automatically purged via a timer.
+// we keep the buffers of the most recently blurred shadow templates,
+// which will be automatically purged via a timer.
 class ScratchBuffer {
     WTF_MAKE_FAST_ALLOCATED;
 public:
+    struct ShadowTemplateKey {
+        bool isInset { false };
+        FloatSize radius;
+        Color color;
+        FloatRect shadowRect;
+        FloatRect insetBounds;
+        FloatRoundedRect::Radii radii;
+        FloatSize layerSize;
+
+        bool operator==(const ShadowTemplateKey& other) const
+        {
+            return isInset == other.isInset && radius == other.radius && color == other.color && shadowRect == other.shadowRect
+                && insetBounds == other.insetBounds && radii == other.radii && layerSize == other.layerSize;
+        }
+    };
+
     ScratchBuffer()
         : m_purgeTimer(*this, &ScratchBuffer::clearScratchBuffer)
-        , m_lastWasInset(false)
 #if ASSERT_ENABLED
         , m_bufferInUse(false)
 #endif
     {
     }
 
-    ImageBuffer* getScratchBuffer(const IntSize& size)
+    // Returns a buffer of at least the given size. redrawNeeded is false only if the buffer
+    // still holds the blurred template drawn for an earlier request with the same key.
+    ImageBuffer* getScratchBuffer(const ShadowTemplateKey& key, const IntSize& size, bool& redrawNeeded)
     {
         ASSERT(!m_bufferInUse);
 #if ASSERT_ENABLED
         m_bufferInUse = true;
 #endif
-        // We do not need to recreate the buffer if the current buffer is large enough.
-        if (m_imageBuffer && m_imageBuffer->logicalSize().width() >= size.width() && m_imageBuffer->logicalSize().height() >= size.height())
-            return m_imageBuffer.get();
-
-        // Round to the nearest 32 pixels so we do not grow the buffer for similar sized requests.
-        IntSize roundedSize(roundUpToMultipleOf32(size.width()), roundUpToMultipleOf32(size.height()));
-
-        clearScratchBuffer();
-
-        // ShadowBlur is not used with accelerated drawing, so it's OK to make an unconditionally unaccelerated buffer.
-        m_imageBuffer = ImageBuffer::create(roundedSize, RenderingMode::Unaccelerated, 1);
-        return m_imageBuffer.get();
-    }
+        redrawNeeded = true;
 
-    bool setCachedShadowValues(const FloatSize& radius, const Color& color, const FloatRect& shadowRect, const FloatRoundedRect::Radii& radii, const FloatSize& layerSize)
-    {
-        if (!m_lastWasInset && m_lastRadius == radius && m_lastColor == color && m_lastShadowRect == shadowRect &&  m_lastRadii == radii && m_lastLayerSize == layerSize)
-            return false;
-
-        m_lastWasInset = false;
-        m_lastRadius = radius;
-        m_lastColor = color;
-        m_lastShadowRect = shadowRect;
-        m_lastRadii = radii;
-        m_lastLayerSize = layerSize;
+        auto index = m_templates.findMatching([&](auto& cachedTemplate) {
+            return cachedTemplate.key == key;
+        });
+        if (index != notFound) {
+            // Keep the templates in most recently used order, so the least recently used one is evicted first.
+            auto cachedTemplate = WTFMove(m_templates[index]);
+            m_templates.remove(index);
+            m_templates.insert(0, WTFMove(cachedTemplate));
+            redrawNeeded = false;
+            return m_templates.first().imageBuffer.get();
+        }
 
-        return true;
-    }
+        RefPtr<ImageBuffer> imageBuffer;
+        if (m_templates.size() == maximumCachedTemplates) {
+            imageBuffer = WTFMove(m_templates.last().imageBuffer);
+            m_templates.removeLast();
+        }
 
-    bool setCachedInsetShadowValues(const FloatSize& radius, const Color& color, const FloatRect& bounds, const FloatRect& shadowRect, const FloatRoundedRect::Radii& radii)
-    {
-        if (m_lastWasInset && m_lastRadius == radius && m_lastColor == color && m_lastInsetBounds == bounds && shadowRect == m_lastShadowRect && radii == m_lastRadii)
-            return false;
+        // We do not need to recreate the buffer if the evicted buffer is large enough.
+        if (!imageBuffer || imageBuffer->logicalSize().width() < size.width() || imageBuffer->logicalSize().height() < size.height()) {
+            // Round to the nearest 32 pixels so we do not grow the buffer for similar sized requests.
+            IntSize roundedSize(roundUpToMultipleOf32(size.width()), roundUpToMultipleOf32(size.height()));
 
-        m_lastWasInset = true;
-        m_lastInsetBounds = bounds;
-        m_lastRadius = radius;
-        m_lastColor = color;
-        m_lastShadowRect = shadowRect;
-        m_lastRadii = radii;
+            // ShadowBlur is not used with accelerated drawing, so it's OK to make an unconditionally unaccelerated buffer.
+            imageBuffer = ImageBuffer::create(roundedSize, RenderingMode::Unaccelerated, 1);
+            if (!imageBuffer)
+                return nullptr;
+        }
 
-        return true;
+        m_templates.insert(0, CachedTemplate { key, imageBuffer });
+        return imageBuffer.get();
     }
 
     void scheduleScratchBufferPurge()
@@ -136,21 +145,18 @@ public:
 private:
     void clearScratchBuffer()
     {
-        m_imageBuffer = nullptr;
-        m_lastRadius = FloatSize();
-        m_lastLayerSize = FloatSize();
+        m_templates.clear();
     }
 
-    RefPtr<ImageBuffer> m_imageBuffer;
-    Timer m_purgeTimer;
+    struct CachedTemplate {
+        ShadowTemplateKey key;
+        RefPtr<ImageBuffer> imageBuffer;
+    };
 
-    FloatRect m_lastInsetBounds;
-    FloatRect m_lastShadowRect;
-    FloatRoundedRect::Radii m_lastRadii;
-    Color m_lastColor;
-    FloatSize m_lastRadius;
-    bool m_lastWasInset;
-    FloatSize m_lastLayerSize;
+    // A few entries are enough for pages that interleave several shadow styles, e.g. cards with buttons.
+    static constexpr size_t maximumCachedTemplates = 4;
+    Vector<CachedTemplate, maximumCachedTemplates> m_templates;
+    Timer m_purgeTimer;
 
 #if ASSERT_ENABLED
     bool m_bufferInUse;
@@ -683,8 +689,19 @@ void ShadowBlur::drawInsetShadowWithoutTiling(const AffineTransform&, const Floa
 
 void ShadowBlur::drawRectShadowWithTiling(const AffineTransform& transform, const FloatRoundedRect& shadowedRect, const IntSize& templateSize, const IntSize& edgeSize, const DrawImageCallback& drawImage, const FillRectCallback& fillRect, const LayerImageProperties& layerImageProperties)
 {
+    FloatRect templateShadow = FloatRect(edgeSize.width(), edgeSize.height(), templateSize.width() - 2 * edgeSize.width(), templateSize.height() - 2 * edgeSize.height());
+
+    bool redrawNeeded = true;
 #if USE(CG)
-    auto* layerImage = ScratchBuffer::singleton().getScratchBuffer(templateSize);
+    // Only redraw in the scratch buffer if its cached contents don't match our needs
+    ScratchBuffer::ShadowTemplateKey templateKey;
+    templateKey.radius = m_blurRadius;
+    templateKey.color = m_color;
+    templateKey.shadowRect = templateShadow;
+    templateKey.radii = shadowedRect.radii();
+    templateKey.layerSize = layerImageProperties.layerSize;
+
+    auto* layerImage = ScratchBuffer::singleton().getScratchBuffer(templateKey, templateSize, redrawNeeded);
     auto releaseLayerImage = makeScopeExit([] {
         ScratchBuffer::singleton().scheduleScratchBufferPurge();
     });
@@ -697,14 +714,6 @@ void ShadowBlur::drawRectShadowWithTiling(const AffineTransform& transform, cons
     if (!layerImage)
         return;
 
-    FloatRect templateShadow = FloatRect(edgeSize.width(), edgeSize.height(), templateSize.width() - 2 * edgeSize.width(), templateSize.height() - 2 * edgeSize.height());
-
-    bool redrawNeeded = true;
-#if USE(CG)
-    // Only redraw in the scratch buffer if its cached contents don't match our needs
-    redrawNeeded = ScratchBuffer::singleton().setCachedShadowValues(m_blurRadius, m_color, templateShadow, shadowedRect.radii(), layerImageProperties.layerSize);
-#endif
-
     if (redrawNeeded) {
         // Draw shadow into the ImageBuffer.
         GraphicsContext& shadowContext = layerImage->context();
@@ -737,8 +746,22 @@ void ShadowBlur::drawRectShadowWithTiling(const AffineTransform& transform, cons
 
 void ShadowBlur::drawInsetShadowWithTiling(const AffineTransform& transform, const FloatRect& fullRect, const FloatRoundedRect& holeRect, const IntSize& templateSize, const IntSize& edgeSize, const DrawImageCallback& drawImage, const FillRectWithHoleCallback& fillRectWithHole)
 {
+    // Draw the rectangle with hole.
+    FloatRect templateBounds(0, 0, templateSize.width(), templateSize.height());
+    FloatRect templateHole = FloatRect(edgeSize.width(), edgeSize.height(), templateSize.width() - 2 * edgeSize.width(), templateSize.height() - 2 * edgeSize.height());
+
+    bool redrawNeeded = true;
 #if USE(CG)
-    auto* layerImage = ScratchBuffer::singleton().getScratchBuffer(templateSize);
+    // Only redraw in the scratch buffer if its cached contents don't match our needs
+    ScratchBuffer::ShadowTemplateKey templateKey;
+    templateKey.isInset = true;
+    templateKey.radius = m_blurRadius;
+    templateKey.color = m_color;
+    templateKey.shadowRect = templateHole;
+    templateKey.insetBounds = templateBounds;
+    templateKey.radii = holeRect.radii();
+
+    auto* layerImage = ScratchBuffer::singleton().getScratchBuffer(templateKey, templateSize, redrawNeeded);
     auto releaseLayerImage = makeScopeExit([] {
         ScratchBuffer::singleton().scheduleScratchBufferPurge();
     });
@@ -750,16 +773,6 @@ void ShadowBlur::drawInsetShadowWithTiling(const AffineTransform& transform, con
     if (!layerImage)
         return;
 
-    // Draw the rectangle with hole.
-    FloatRect templateBounds(0, 0, templateSize.width(), templateSize.height());
-    FloatRect templateHole = FloatRect(edgeSize.width(), edgeSize.height(), templateSize.width() - 2 * edgeSize.width(), templateSize.height() - 2 * edgeSize.height());
-
-    bool redrawNeeded = true;
-#if USE(CG)
-    // Only redraw in the scratch buffer if its cached contents don't match our needs
-    redrawNeeded = ScratchBuffer::singleton().setCachedInsetShadowValues(m_blurRadius, m_color, templateBounds, templateHole, holeRect.radii());
-#endif
-
     if (redrawNeeded) {
         // Draw shadow into a new ImageBuffer.
         GraphicsContext& shadowContext = layerImage->context();
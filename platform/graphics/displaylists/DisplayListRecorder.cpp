@@ -51,6 +51,7 @@ Recorder::Recorder(GraphicsContext& context, DisplayList& displayList, const Gra
 Recorder::~Recorder()
 {
     ASSERT(m_stateStack.size() == 1); // If this fires, it indicates mismatched save/restore.
+    LOG_WITH_STREAM(DisplayLists, stream << "Recorded " << m_displayList.sizeInBytes() << " bytes of items, elided " << m_elidedSaveRestoreCount << " empty save/restore pairs");
     LOG(DisplayLists, "Recorded display list:\n%s", m_displayList.description().data());
 }
 
@@ -104,8 +105,24 @@ void Recorder::appendStateChangeItem(const GraphicsContextStateChange& changes,
         append<SetInlineFillGradient>(*changes.m_state.fillGradient);
 }
 
+void Recorder::appendPendingSaves()
+{
+    // Pending saves always sit on top of the state stack, above the last state whose Save was appended.
+    auto firstPendingIndex = m_stateStack.size();
+    while (firstPendingIndex > 1 && !m_stateStack[firstPendingIndex - 1].didAppendSave)
+        --firstPendingIndex;
+
+    for (auto index = firstPendingIndex; index < m_stateStack.size(); ++index) {
+        m_stateStack[index].didAppendSave = true;
+        append<Save>();
+    }
+}
+
 void Recorder::willAppendItemOfType(ItemType type)
 {
+    if (type != ItemType::Save && !currentState().didAppendSave)
+        appendPendingSaves();
+
     if (m_delegate)
         m_delegate->willAppendItemOfType(type);
 
@@ -198,7 +215,6 @@ void Recorder::drawPattern(NativeImage& image, const FloatSize& imageSize, const
 
 void Recorder::save()
 {
-    append<Save>();
     m_stateStack.append(m_stateStack.last().cloneForSave());
 }
 
@@ -208,11 +224,18 @@ void Recorder::restore()
         return;
 
     bool stateUsedForDrawing = currentState().wasUsedForDrawing;
+    bool didAppendSave = currentState().didAppendSave;
 
     m_stateStack.removeLast();
     // Have to avoid eliding nested Save/Restore when a descendant state contains drawing items.
     currentState().wasUsedForDrawing |= stateUsedForDrawing;
 
+    if (!didAppendSave) {
+        // Nothing was recorded since the matching save(), so neither item is needed.
+        ++m_elidedSaveRestoreCount;
+        return;
+    }
+
     append<Restore>();
 }
 
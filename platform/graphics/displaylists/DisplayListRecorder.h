@@ -170,6 +170,7 @@ private:
     }
 
     WEBCORE_EXPORT void willAppendItemOfType(ItemType);
+    void appendPendingSaves();
 
     void appendStateChangeItem(const GraphicsContextStateChange&, GraphicsContextState::StateChangeFlags);
 
@@ -184,6 +185,8 @@ private:
         GraphicsContextStateChange stateChange;
         GraphicsContextState lastDrawingState;
         bool wasUsedForDrawing { false };
+        // Save items are appended lazily, so that a Save/Restore pair with nothing recorded in between is elided.
+        bool didAppendSave { true };
         
         ContextState(const GraphicsContextState& state, const AffineTransform& transform, const FloatRect& clip)
             : ctm(transform)
@@ -196,6 +199,7 @@ private:
         {
             ContextState state(lastDrawingState, ctm, clipBounds);
             state.stateChange = stateChange;
+            state.didAppendSave = false;
             return state;
         }
 
@@ -213,6 +217,7 @@ private:
     Delegate* m_delegate;
 
     Vector<ContextState, 32> m_stateStack;
+    unsigned m_elidedSaveRestoreCount { 0 };
 
     DrawGlyphsRecorder m_drawGlyphsRecorder;
 };
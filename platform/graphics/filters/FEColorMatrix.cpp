@@ -63,7 +63,7 @@ bool FEColorMatrix::setValues(const Vector<float> &values)
     return true;
 }
 
-inline void matrix(float& red, float& green, float& blue, float& alpha, const Vector<float>& values)
+inline void matrix(float& red, float& green, float& blue, float& alpha, const std::array<float, 20>& values)
 {
     float r = red;
     float g = green;
@@ -228,19 +228,26 @@ void effectType(Uint8ClampedArray& pixelArray, const Vector<float>& values, IntS
 #endif
 
     switch (filterType) {
-    case FECOLORMATRIX_TYPE_MATRIX:
+    case FECOLORMATRIX_TYPE_MATRIX: {
+        // Copy the coefficients out of the Vector so that stores to the pixel data, which may alias
+        // anything, do not force them to be reloaded for every pixel.
+        ASSERT(values.size() >= 20);
+        std::array<float, 20> coefficients;
+        std::copy_n(values.begin(), coefficients.size(), coefficients.begin());
+
         for (unsigned pixelByteOffset = 0; pixelByteOffset < pixelArrayLength; pixelByteOffset += 4) {
             float red = pixelArray.item(pixelByteOffset);
             float green = pixelArray.item(pixelByteOffset + 1);
             float blue = pixelArray.item(pixelByteOffset + 2);
             float alpha = pixelArray.item(pixelByteOffset + 3);
-            matrix(red, green, blue, alpha, values);
+            matrix(red, green, blue, alpha, coefficients);
             pixelArray.set(pixelByteOffset, red);
             pixelArray.set(pixelByteOffset + 1, green);
             pixelArray.set(pixelByteOffset + 2, blue);
             pixelArray.set(pixelByteOffset + 3, alpha);
         }
         break;
+    }
 
     case FECOLORMATRIX_TYPE_SATURATE:
     case FECOLORMATRIX_TYPE_HUEROTATE:
@@ -31,22 +31,27 @@
 
 #include "NicosiaPaintingEngineBasic.h"
 #include "NicosiaPaintingEngineThreaded.h"
+#include <wtf/NumberOfCores.h>
 
 namespace Nicosia {
 
 std::unique_ptr<PaintingEngine> PaintingEngine::create()
 {
 #if (ENABLE(DEVELOPER_MODE) && PLATFORM(WPE)) || USE(GTK4)
+    // Dirty tiles are replayed concurrently, so use one painting thread per core.
+    unsigned numberOfCores = std::max(WTF::numberOfProcessorCores(), 1);
+    unsigned maxNumThreads = std::max(numberOfCores, 8u);
 #if USE(GTK4)
-    unsigned numThreads = 4;
+    unsigned defaultNumThreads = numberOfCores;
 #else
-    unsigned numThreads = 0;
+    unsigned defaultNumThreads = 0;
 #endif
+    unsigned numThreads = defaultNumThreads;
     if (const char* numThreadsEnv = getenv("WEBKIT_NICOSIA_PAINTING_THREADS")) {
         if (sscanf(numThreadsEnv, "%u", &numThreads) == 1) {
-            if (numThreads > 8) {
-                WTFLogAlways("The number of Nicosia painting threads is not between 1 and 8. Using the default value 4\n");
-                numThreads = 4;
+            if (numThreads > maxNumThreads) {
+                WTFLogAlways("The number of Nicosia painting threads is not between 1 and %u. Using the default value %u\n", maxNumThreads, defaultNumThreads);
+                numThreads = defaultNumThreads;
             }
         }
     }
@@ -42,91 +42,83 @@ AutoTableLayout::AutoTableLayout(RenderTable* table)
 
 AutoTableLayout::~AutoTableLayout() = default;
 
-void AutoTableLayout::recalcColumn(unsigned effCol)
+void AutoTableLayout::recalcColumn(unsigned effCol, const Vector<RenderTableSection*>& sections)
 {
     Layout& columnLayout = m_layoutStruct[effCol];
 
     RenderTableCell* fixedContributor = nullptr;
     RenderTableCell* maxContributor = nullptr;
 
-    for (auto& child : childrenOfType<RenderObject>(*m_table)) {
-        if (is<RenderTableCol>(child)) {
-            // RenderTableCols don't have the concept of preferred logical width, but we need to clear their dirty bits
-            // so that if we call setPreferredWidthsDirty(true) on a col or one of its descendants, we'll mark it's
-            // ancestors as dirty.
-            downcast<RenderTableCol>(child).clearPreferredLogicalWidthsDirtyBits();
-        } else if (is<RenderTableSection>(child)) {
-            auto& section = downcast<RenderTableSection>(child);
-            unsigned numRows = section.numRows();
-            for (unsigned i = 0; i < numRows; ++i) {
-                RenderTableSection::CellStruct current = section.cellAt(i, effCol);
-                RenderTableCell* cell = current.primaryCell();
-                
-                if (current.inColSpan || !cell)
-                    continue;
-
-                bool cellHasContent = cell->firstChild() || cell->style().hasBorder() || cell->style().hasPadding() || cell->style().hasBackground();
-                if (cellHasContent)
-                    columnLayout.emptyCellsOnly = false;
-
-                // A cell originates in this column. Ensure we have
-                // a min/max width of at least 1px for this column now.
-                columnLayout.minLogicalWidth = std::max(columnLayout.minLogicalWidth, 0.f);
-                columnLayout.maxLogicalWidth = std::max(columnLayout.maxLogicalWidth, 0.f);
-
-                if (cell->colSpan() == 1) {
-                    columnLayout.minLogicalWidth = std::max(cell->minPreferredLogicalWidth().ceilToFloat(), columnLayout.minLogicalWidth);
-                    float maxPreferredWidth = cell->maxPreferredLogicalWidth().ceilToFloat();
-                    if (maxPreferredWidth > columnLayout.maxLogicalWidth) {
-                        columnLayout.maxLogicalWidth = maxPreferredWidth;
-                        maxContributor = cell;
-                    }
+    for (auto* section : sections) {
+        unsigned numRows = section->numRows();
+        for (unsigned i = 0; i < numRows; ++i) {
+            auto& current = section->cellAt(i, effCol);
+            RenderTableCell* cell = current.primaryCell();
+            
+            if (current.inColSpan || !cell)
+                continue;
 
-                    // All browsers implement a size limit on the cell's max width. 
-                    // Our limit is based on KHTML's representation that used 16 bits widths.
-                    // FIXME: Other browsers have a lower limit for the cell's max width. 
-                    const float cCellMaxWidth = 32760;
-                    Length cellLogicalWidth = cell->styleOrColLogicalWidth();
-                    if (cellLogicalWidth.value() > cCellMaxWidth)
-                        cellLogicalWidth.setValue(Fixed, cCellMaxWidth);
-                    if (cellLogicalWidth.isNegative())
-                        cellLogicalWidth.setValue(Fixed, 0);
-                    switch (cellLogicalWidth.type()) {
-                    case Fixed:
-                        // ignore width=0
-                        if (cellLogicalWidth.isPositive() && !columnLayout.logicalWidth.isPercentOrCalculated()) {
-                            float logicalWidth = cell->adjustBorderBoxLogicalWidthForBoxSizing(cellLogicalWidth);
-                            if (columnLayout.logicalWidth.isFixed()) {
-                                // Nav/IE weirdness
-                                if ((logicalWidth > columnLayout.logicalWidth.value()) 
-                                    || ((columnLayout.logicalWidth.value() == logicalWidth) && (maxContributor == cell))) {
-                                    columnLayout.logicalWidth.setValue(Fixed, logicalWidth);
-                                    fixedContributor = cell;
-                                }
-                            } else {
+            bool cellHasContent = cell->firstChild() || cell->style().hasBorder() || cell->style().hasPadding() || cell->style().hasBackground();
+            if (cellHasContent)
+                columnLayout.emptyCellsOnly = false;
+
+            // A cell originates in this column. Ensure we have
+            // a min/max width of at least 1px for this column now.
+            columnLayout.minLogicalWidth = std::max(columnLayout.minLogicalWidth, 0.f);
+            columnLayout.maxLogicalWidth = std::max(columnLayout.maxLogicalWidth, 0.f);
+
+            if (cell->colSpan() == 1) {
+                columnLayout.minLogicalWidth = std::max(cell->minPreferredLogicalWidth().ceilToFloat(), columnLayout.minLogicalWidth);
+                float maxPreferredWidth = cell->maxPreferredLogicalWidth().ceilToFloat();
+                if (maxPreferredWidth > columnLayout.maxLogicalWidth) {
+                    columnLayout.maxLogicalWidth = maxPreferredWidth;
+                    maxContributor = cell;
+                }
+
+                // All browsers implement a size limit on the cell's max width. 
+                // Our limit is based on KHTML's representation that used 16 bits widths.
+                // FIXME: Other browsers have a lower limit for the cell's max width. 
+                const float cCellMaxWidth = 32760;
+                Length cellLogicalWidth = cell->styleOrColLogicalWidth();
+                if (cellLogicalWidth.value() > cCellMaxWidth)
+                    cellLogicalWidth.setValue(Fixed, cCellMaxWidth);
+                if (cellLogicalWidth.isNegative())
+                    cellLogicalWidth.setValue(Fixed, 0);
+                switch (cellLogicalWidth.type()) {
+                case Fixed:
+                    // ignore width=0
+                    if (cellLogicalWidth.isPositive() && !columnLayout.logicalWidth.isPercentOrCalculated()) {
+                        float logicalWidth = cell->adjustBorderBoxLogicalWidthForBoxSizing(cellLogicalWidth);
+                        if (columnLayout.logicalWidth.isFixed()) {
+                            // Nav/IE weirdness
+                            if ((logicalWidth > columnLayout.logicalWidth.value()) 
+                                || ((columnLayout.logicalWidth.value() == logicalWidth) && (maxContributor == cell))) {
                                 columnLayout.logicalWidth.setValue(Fixed, logicalWidth);
                                 fixedContributor = cell;
                             }
+                        } else {
+                            columnLayout.logicalWidth.setValue(Fixed, logicalWidth);
+                            fixedContributor = cell;
                         }
-                        break;
-                    case Percent:
-                        m_hasPercent = true;
-                        if (cellLogicalWidth.isPositive() && (!columnLayout.logicalWidth.isPercent() || cellLogicalWidth.percent() > columnLayout.logicalWidth.percent()))
-                            columnLayout.logicalWidth = cellLogicalWidth;
-                        break;
-                    case Relative:
-                        // FIXME: Need to understand this case and whether it makes sense to compare values
-                        // which are not necessarily of the same type.
-                        if (cellLogicalWidth.value() > columnLayout.logicalWidth.value())
-                            columnLayout.logicalWidth = cellLogicalWidth;
-                        break;
-                    default:
-                        break;
                     }
-                } else if (!effCol || section.primaryCellAt(i, effCol - 1) != cell) {
-                    // This spanning cell originates in this column. Insert the cell into spanning cells list.
-                    insertSpanCell(cell);
+                    break;
+                case Percent:
+                    m_hasPercent = true;
+                    if (cellLogicalWidth.isPositive() && (!columnLayout.logicalWidth.isPercent() || cellLogicalWidth.percent() > columnLayout.logicalWidth.percent()))
+                        columnLayout.logicalWidth = cellLogicalWidth;
+                    break;
+                case Relative:
+                    // FIXME: Need to understand this case and whether it makes sense to compare values
+                    // which are not necessarily of the same type.
+                    if (cellLogicalWidth.value() > columnLayout.logicalWidth.value())
+                        columnLayout.logicalWidth = cellLogicalWidth;
+                    break;
+                default:
+                    break;
                 }
+            } else if (!effCol || section->primaryCellAt(i, effCol - 1) != cell) {
+                // This spanning cell originates in this column. Insert the cell into spanning cells list.
+                insertSpanCell(cell);
             }
         }
     }
@@ -178,8 +170,20 @@ void AutoTableLayout::fullRecalc()
             groupLogicalWidth = Length();
     }
 
+    // Collect the non-empty sections once instead of walking the table's children for every column.
+    Vector<RenderTableSection*> sections;
+    for (auto& child : childrenOfType<RenderObject>(*m_table)) {
+        if (is<RenderTableCol>(child)) {
+            // RenderTableCols don't have the concept of preferred logical width, but we need to clear their dirty bits
+            // so that if we call setPreferredWidthsDirty(true) on a col or one of its descendants, we'll mark it's
+            // ancestors as dirty.
+            downcast<RenderTableCol>(child).clearPreferredLogicalWidthsDirtyBits();
+        } else if (is<RenderTableSection>(child) && downcast<RenderTableSection>(child).numRows())
+            sections.append(&downcast<RenderTableSection>(child));
+    }
+
     for (unsigned i = 0; i < nEffCols; i++)
-        recalcColumn(i);
+        recalcColumn(i, sections);
 }
 
 static bool shouldScaleColumnsForParent(const RenderTable& table)
@@ -29,6 +29,7 @@ namespace WebCore {
 
 class RenderTable;
 class RenderTableCell;
+class RenderTableSection;
 
 class AutoTableLayout final : public TableLayout {
 public:
@@ -42,7 +43,7 @@ public:
 
 private:
     void fullRecalc();
-    void recalcColumn(unsigned effCol);
+    void recalcColumn(unsigned effCol, const Vector<RenderTableSection*>&);
 
     float calcEffectiveLogicalWidth();
 
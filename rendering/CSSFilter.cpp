@@ -366,6 +366,20 @@ void CSSFilter::clearIntermediateResults()
         effect->clearResult();
 }
 
+void CSSFilter::clearIntermediateResultsExceptOutput()
+{
+    m_sourceGraphic->clearResult();
+    if (m_sourceAlpha)
+        m_sourceAlpha->clearResult();
+    for (size_t i = 0; i + 1 < m_effects.size(); ++i)
+        m_effects[i]->clearResult();
+}
+
+bool CSSFilter::hasOutputFromSoftwareApply() const
+{
+    return !m_effects.isEmpty() && m_effects.last()->hasResult();
+}
+
 void CSSFilter::apply()
 {
     auto& effect = m_effects.last().get();
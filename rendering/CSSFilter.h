@@ -56,6 +56,8 @@ public:
 
     bool build(RenderElement&, const FilterOperations&, FilterConsumer);
     void clearIntermediateResults();
+    void clearIntermediateResultsExceptOutput();
+    bool hasOutputFromSoftwareApply() const;
     void apply();
 
     bool hasFilterThatMovesPixels() const { return m_hasFilterThatMovesPixels; }
@@ -29,6 +29,7 @@
 #include "Grid.h"
 #include "GridArea.h"
 #include "GridLayoutFunctions.h"
+#include "Logging.h"
 #include "RenderGrid.h"
 
 namespace WebCore {
@@ -761,12 +762,35 @@ LayoutUnit GridTrackSizingAlgorithmStrategy::logicalHeightForChild(RenderBox& ch
         child.setNeedsLayout(MarkOnlyThis);
     }
 
-    // We need to clear the stretched height to properly compute logical height during layout.
-    if (child.needsLayout())
+    auto baselineOffset = m_algorithm.baselineOffsetForChild(child, gridAxisForDirection(direction()));
+    // Baseline aligned items need to be laid out to have their baselines computed.
+    auto canUseIntrinsicBlockSizeCache = !m_algorithm.isBaselineAlignedItem(child);
+    auto cacheKey = [&] {
+        auto childInlineDirection = GridLayoutFunctions::flowAwareDirectionForChild(*renderGrid(), child, ForColumns);
+        auto key = GridTrackSizingAlgorithm::IntrinsicBlockSizeCacheKey { };
+        if (GridLayoutFunctions::hasOverridingContainingBlockContentSizeForChild(child, childInlineDirection))
+            key.containingBlockInlineSize = GridLayoutFunctions::overridingContainingBlockContentSizeForChild(child, childInlineDirection);
+        if (GridLayoutFunctions::hasOverridingContainingBlockContentSizeForChild(child, childBlockDirection))
+            key.containingBlockBlockSize = GridLayoutFunctions::overridingContainingBlockContentSizeForChild(child, childBlockDirection);
+        return key;
+    }();
+
+    if (child.needsLayout()) {
+        // The item is dirty only because we changed its containing block size. Skip the layout if we've already
+        // seen this size during the current grid layout. The item stays dirty and gets laid out in layoutGridItems().
+        if (canUseIntrinsicBlockSizeCache) {
+            if (auto blockSize = m_algorithm.cachedIntrinsicBlockSizeForChild(child, cacheKey))
+                return *blockSize + baselineOffset;
+        }
+        // We need to clear the stretched height to properly compute logical height during layout.
         child.clearOverridingLogicalHeight();
+    }
 
     child.layoutIfNeeded();
-    return child.logicalHeight() + GridLayoutFunctions::marginLogicalSizeForChild(*renderGrid(), childBlockDirection, child) + m_algorithm.baselineOffsetForChild(child, gridAxisForDirection(direction()));
+    auto blockSize = child.logicalHeight() + GridLayoutFunctions::marginLogicalSizeForChild(*renderGrid(), childBlockDirection, child);
+    if (canUseIntrinsicBlockSizeCache)
+        m_algorithm.cacheIntrinsicBlockSizeForChild(child, cacheKey, blockSize);
+    return blockSize + baselineOffset;
 }
 
 LayoutUnit GridTrackSizingAlgorithmStrategy::minContentForChild(RenderBox& child) const
@@ -876,6 +900,33 @@ LayoutUnit GridTrackSizingAlgorithm::baselineOffsetForChild(const RenderBox& chi
     return m_baselineAlignment.baselineOffsetForChild(align, span.startLine(), child, baselineAxis);
 }
 
+Optional<LayoutUnit> GridTrackSizingAlgorithm::cachedIntrinsicBlockSizeForChild(const RenderBox& child, const IntrinsicBlockSizeCacheKey& key)
+{
+    auto it = m_intrinsicBlockSizeCache.find(&child);
+    if (it != m_intrinsicBlockSizeCache.end()) {
+        for (auto& entry : it->value) {
+            if (entry.key == key) {
+                ++m_intrinsicBlockSizeCacheHitCount;
+                return entry.blockSize;
+            }
+        }
+    }
+    ++m_intrinsicBlockSizeCacheMissCount;
+    return { };
+}
+
+void GridTrackSizingAlgorithm::cacheIntrinsicBlockSizeForChild(const RenderBox& child, const IntrinsicBlockSizeCacheKey& key, LayoutUnit blockSize)
+{
+    auto& entries = m_intrinsicBlockSizeCache.add(&child, Vector<IntrinsicBlockSizeCacheEntry, 2> { }).iterator->value;
+    for (auto& entry : entries) {
+        if (entry.key == key) {
+            entry.blockSize = blockSize;
+            return;
+        }
+    }
+    entries.append({ key, blockSize });
+}
+
 void GridTrackSizingAlgorithm::clearBaselineItemsCache()
 {
     m_columnBaselineItemsMap.clear();
@@ -1362,6 +1413,11 @@ void GridTrackSizingAlgorithm::reset()
     setAvailableSpace(ForRows, WTF::nullopt);
     setAvailableSpace(ForColumns, WTF::nullopt);
     m_hasPercentSizedRowsIndefiniteHeight = false;
+
+    LOG_WITH_STREAM(Layout, stream << "GridTrackSizingAlgorithm::reset " << m_renderGrid << " intrinsic block size cache hits " << m_intrinsicBlockSizeCacheHitCount << " misses " << m_intrinsicBlockSizeCacheMissCount);
+    m_intrinsicBlockSizeCache.clear();
+    m_intrinsicBlockSizeCacheHitCount = 0;
+    m_intrinsicBlockSizeCacheMissCount = 0;
 }
 
 #if ASSERT_ENABLED
@@ -170,6 +170,17 @@ private:
     bool isIntrinsicSizedGridArea(const RenderBox&, GridAxis) const;
     void computeGridContainerIntrinsicSizes();
 
+    // Block-axis contributions of grid items for the containing block sizes they were laid out with.
+    struct IntrinsicBlockSizeCacheKey {
+        Optional<LayoutUnit> containingBlockInlineSize;
+        Optional<Optional<LayoutUnit>> containingBlockBlockSize;
+
+        bool operator==(const IntrinsicBlockSizeCacheKey& other) const { return containingBlockInlineSize == other.containingBlockInlineSize && containingBlockBlockSize == other.containingBlockBlockSize; }
+    };
+    Optional<LayoutUnit> cachedIntrinsicBlockSizeForChild(const RenderBox&, const IntrinsicBlockSizeCacheKey&);
+    void cacheIntrinsicBlockSizeForChild(const RenderBox&, const IntrinsicBlockSizeCacheKey&, LayoutUnit);
+    bool isBaselineAlignedItem(const RenderBox& child) const { return m_columnBaselineItemsMap.contains(&child) || m_rowBaselineItemsMap.contains(&child); }
+
     // Helper methods for step 4. Strech flexible tracks.
     typedef HashSet<unsigned, DefaultHash<unsigned>, WTF::UnsignedWithZeroKeyHashTraits<unsigned>> TrackIndexSet;
     double computeFlexFactorUnitSize(const Vector<GridTrack>& tracks, double flexFactorSum, LayoutUnit& leftOverSpace, const Vector<unsigned, 8>& flexibleTracksIndexes, std::unique_ptr<TrackIndexSet> tracksToTreatAsInflexible = nullptr) const;
@@ -235,6 +246,17 @@ private:
     BaselineItemsCache m_columnBaselineItemsMap;
     BaselineItemsCache m_rowBaselineItemsMap;
 
+    // Sizing iterations (intrinsic vs. definite, the second pass of step 3, orthogonal items) keep
+    // flipping a grid item between the same few containing block sizes. The cache lives for a single
+    // grid layout (see reset()), so it never outlives the item's own dirty state.
+    struct IntrinsicBlockSizeCacheEntry {
+        IntrinsicBlockSizeCacheKey key;
+        LayoutUnit blockSize;
+    };
+    HashMap<const RenderBox*, Vector<IntrinsicBlockSizeCacheEntry, 2>> m_intrinsicBlockSizeCache;
+    unsigned m_intrinsicBlockSizeCacheHitCount { 0 };
+    unsigned m_intrinsicBlockSizeCacheMissCount { 0 };
+
     // This is a RAII class used to ensure that the track sizing algorithm is
     // executed as it is suppossed to be, i.e., first resolve columns and then
     // rows. Only if required a second iteration is run following the same order,
@@ -77,8 +77,12 @@ COMPILE_ASSERT(sizeof(InlineTextBox) == sizeof(SameSizeAsInlineTextBox), InlineT
 typedef WTF::HashMap<const InlineTextBox*, LayoutRect> InlineTextBoxOverflowMap;
 static InlineTextBoxOverflowMap* gTextBoxesWithOverflow;
 
+size_t InlineTextBox::s_instanceCount { 0 };
+
 InlineTextBox::~InlineTextBox()
 {
+    ASSERT(s_instanceCount);
+    --s_instanceCount;
     if (!knownToHaveNoOverflow() && gTextBoxesWithOverflow)
         gTextBoxesWithOverflow->remove(this);
     TextPainter::removeGlyphDisplayList(*this);
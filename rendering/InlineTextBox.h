@@ -46,10 +46,14 @@ public:
         : InlineBox(renderer)
     {
         setBehavesLikeText(true);
+        ++s_instanceCount;
     }
 
     virtual ~InlineTextBox();
 
+    // Number of legacy text boxes currently alive (reported through the memory usage statistics).
+    static size_t instanceCount() { return s_instanceCount; }
+
     RenderText& renderer() const { return downcast<RenderText>(InlineBox::renderer()); }
     const RenderStyle& lineStyle() const { return isFirstLine() ? renderer().firstLineStyle() : renderer().style(); }
 
@@ -208,6 +212,8 @@ private:
     // Where to truncate when text overflow is applied. We use special constants to
     // denote no truncation (the whole run paints) and full truncation (nothing paints at all).
     unsigned short m_truncation { cNoTruncation };
+
+    static size_t s_instanceCount;
 };
 
 LayoutRect snappedSelectionRect(const LayoutRect&, float logicalRight, float selectionTop, float selectionHeight, bool isHorizontal);
@@ -3691,9 +3691,15 @@ void RenderBlockFlow::layoutModernLines(bool relayoutChildren, LayoutUnit& repai
         renderer.clearNeedsLayout();
     }
 
-    layoutFormattingContextLineLayout.layout();
+    auto& layoutContext = view().frameView().layoutContext();
+    if (UNLIKELY(layoutContext.isTrackingLayoutStatistics())) {
+        auto startTime = MonotonicTime::now();
+        layoutFormattingContextLineLayout.layout();
+        layoutContext.recordLayoutStatistics("LayoutIntegration::LineLayout", { }, MonotonicTime::now() - startTime);
+    } else
+        layoutFormattingContextLineLayout.layout();
 
-    if (view().frameView().layoutContext().layoutState()->isPaginated())
+    if (layoutContext.layoutState()->isPaginated())
         layoutFormattingContextLineLayout.adjustForPagination();
 
     auto contentHeight = layoutFormattingContextLineLayout.contentLogicalHeight();
@@ -93,6 +93,8 @@ namespace WebCore {
 
 WTF_MAKE_ISO_ALLOCATED_IMPL(RenderElement);
 
+unsigned RenderElement::s_layoutStatisticsTrackingCount = 0;
+
 struct SameSizeAsRenderElement : public RenderObject {
     unsigned bitfields : 25;
     void* firstChild;
@@ -1127,6 +1129,18 @@ void RenderElement::layout()
     clearNeedsLayout();
 }
 
+void RenderElement::layoutAndRecordStatistics()
+{
+    auto& layoutContext = view().frameView().layoutContext();
+    if (!layoutContext.isTrackingLayoutStatistics())
+        return layout();
+
+    auto cause = FrameViewLayoutContext::relayoutCause(*this);
+    auto startTime = MonotonicTime::now();
+    layout();
+    layoutContext.recordLayoutStatistics(renderName(), cause, MonotonicTime::now() - startTime);
+}
+
 static bool mustRepaintFillLayers(const RenderElement& renderer, const FillLayer& layer)
 {
     // Nobody will use multiple layers without wanting fancy positioning.
@@ -121,7 +121,10 @@ public:
     virtual void layout();
 
     /* This function performs a layout only if one is needed. */
-    void layoutIfNeeded() { if (needsLayout()) layout(); }
+    void layoutIfNeeded();
+
+    // Number of FrameViewLayoutContexts tracking layout statistics. Keeps layoutIfNeeded() at a single extra branch otherwise.
+    static unsigned s_layoutStatisticsTrackingCount;
 
     // Updates only the local style ptr of the object. Does not update the state of the object,
     // and so only should be called when the style is known not to have changed (or from setStyle).
@@ -314,6 +317,8 @@ private:
     // normal flow object.
     void handleDynamicFloatPositionChange();
 
+    void layoutAndRecordStatistics();
+
     bool shouldRepaintForStyleDifference(StyleDifference) const;
     bool hasImmediateNonWhitespaceTextChildOrBorderOrOutline() const;
 
@@ -368,6 +373,15 @@ private:
     RenderStyle m_style;
 };
 
+inline void RenderElement::layoutIfNeeded()
+{
+    if (!needsLayout())
+        return;
+    if (UNLIKELY(s_layoutStatisticsTrackingCount))
+        return layoutAndRecordStatistics();
+    layout();
+}
+
 inline void RenderElement::setAncestorLineBoxDirty(bool f)
 {
     m_ancestorLineBoxDirty = f;
@@ -854,12 +854,33 @@ void RenderFlexibleBox::cacheChildMainSize(const RenderBox& child)
     }
   
     m_intrinsicSizeAlongMainAxis.set(&child, mainSize);
+    if (isHorizontalWritingMode() == child.isHorizontalWritingMode())
+        m_intrinsicSizeAlongMainAxisAvailableLogicalWidth.set(&child, availableLogicalWidth());
+    else
+        m_intrinsicSizeAlongMainAxisAvailableLogicalWidth.remove(&child);
     m_relaidOutChildren.add(&child);
 }
 
+bool RenderFlexibleBox::canReuseCachedChildMainSize(const RenderBox& child) const
+{
+    // A clean child's main size only depends on the available logical width it was measured with: the measure layout
+    // runs without a containing block height (percentages are treated as auto) and without any overriding size.
+    if (child.needsLayout() || child.hasRelativeLogicalHeight())
+        return false;
+    auto* layoutState = view().frameView().layoutContext().layoutState();
+    if (layoutState && layoutState->isPaginated())
+        return false;
+    auto it = m_intrinsicSizeAlongMainAxisAvailableLogicalWidth.find(&child);
+    if (it == m_intrinsicSizeAlongMainAxisAvailableLogicalWidth.end())
+        return false;
+    ASSERT(m_intrinsicSizeAlongMainAxis.contains(&child));
+    return it->value == availableLogicalWidth();
+}
+
 void RenderFlexibleBox::clearCachedMainSizeForChild(const RenderBox& child)
 {
     m_intrinsicSizeAlongMainAxis.remove(&child);
+    m_intrinsicSizeAlongMainAxisAvailableLogicalWidth.remove(&child);
 }
 
     
@@ -1233,6 +1254,10 @@ FlexItem RenderFlexibleBox::constructFlexItem(RenderBox& child, bool relayoutChi
         // child.intrinsicContentLogicalHeight() and child.scrollbarLogicalHeight(),
         // so if the child has intrinsic min/max/preferred size, run layout on it now to make sure
         // its logical height and scroll bars are up to date.
+        // Nested flex containers relayout their children on every pass. When nothing changed for this child since
+        // it was last measured, keep using the cached main size and leave the (forced) relayout to layoutAndPlaceChildren.
+        if (relayoutChildren && canReuseCachedChildMainSize(child))
+            relayoutChildren = false;
         updateBlockChildDirtyBitsBeforeLayout(relayoutChildren, child);
         // Don't resolve percentages in children. This is especially important for the min-height calculation,
         // where we want percentages to be treated as auto. For flex-basis itself, this is not a problem because
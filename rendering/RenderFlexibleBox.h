@@ -153,6 +153,7 @@ private:
     Overflow mainAxisOverflowForChild(const RenderBox& child) const;
     Overflow crossAxisOverflowForChild(const RenderBox& child) const;
     void cacheChildMainSize(const RenderBox& child);
+    bool canReuseCachedChildMainSize(const RenderBox& child) const;
     Optional<LayoutUnit> crossSizeForPercentageResolution(const RenderBox&);
     Optional<LayoutUnit> mainSizeForPercentageResolution(const RenderBox&);
 
@@ -199,6 +200,10 @@ private:
     // This is used to cache the preferred size for orthogonal flow children so we
     // don't have to relayout to get it
     HashMap<const RenderBox*, LayoutUnit> m_intrinsicSizeAlongMainAxis;
+    // The available logical width the cached main size above was measured with. It lets
+    // us skip the measure layout when we are asked to relayout children without
+    // anything changing for this particular child.
+    HashMap<const RenderBox*, LayoutUnit> m_intrinsicSizeAlongMainAxisAvailableLogicalWidth;
     
     // This is used to cache the intrinsic size on the cross axis to avoid
     // relayouts when stretching.
@@ -4574,7 +4574,7 @@ GraphicsContext* RenderLayer::setupFilters(GraphicsContext& destinationContext,
 
     auto rootRelativeBounds = calculateLayerBounds(paintingInfo.rootLayer, offsetFromRoot, { });
 
-    GraphicsContext* filterContext = paintingFilters->beginFilterEffect(destinationContext, enclosingIntRect(rootRelativeBounds), enclosingIntRect(paintingInfo.paintDirtyRect), enclosingIntRect(filterRepaintRect));
+    GraphicsContext* filterContext = paintingFilters->beginFilterEffect(destinationContext, enclosingIntRect(rootRelativeBounds), enclosingIntRect(paintingInfo.paintDirtyRect), enclosingIntRect(filterRepaintRect), paintingInfo.paintBehavior, paintFlags, paintingInfo.subtreePaintRoot);
     if (!filterContext)
         return nullptr;
 
@@ -36,12 +36,14 @@
 #include "CachedSVGDocumentReference.h"
 #include "Logging.h"
 #include "RenderSVGResourceFilter.h"
+#include <wtf/MemoryPressureHandler.h>
 #include <wtf/NeverDestroyed.h>
 
 namespace WebCore {
 
 RenderLayerFilters::RenderLayerFilters(RenderLayer& layer)
     : m_layer(layer)
+    , m_purgeOutputTimer(*this, &RenderLayerFilters::purgeOutputTimerFired)
 {
 }
 
@@ -65,6 +67,12 @@ bool RenderLayerFilters::hasFilterThatShouldBeRestrictedBySecurityOrigin() const
     return m_filter && m_filter->hasFilterThatShouldBeRestrictedBySecurityOrigin();
 }
 
+void RenderLayerFilters::purgeOutputTimerFired()
+{
+    if (m_filter)
+        m_filter->clearIntermediateResults();
+}
+
 void RenderLayerFilters::notifyFinished(CachedResource&, const NetworkLoadMetrics&)
 {
     // FIXME: This really shouldn't have to invalidate layer composition,
@@ -134,7 +142,7 @@ void RenderLayerFilters::buildFilter(RenderElement& renderer, float scaleFactor,
         m_filter = nullptr;
 }
 
-GraphicsContext* RenderLayerFilters::beginFilterEffect(GraphicsContext& destinationContext, const LayoutRect& filterBoxRect, const LayoutRect& dirtyRect, const LayoutRect& layerRepaintRect)
+GraphicsContext* RenderLayerFilters::beginFilterEffect(GraphicsContext& destinationContext, const LayoutRect& filterBoxRect, const LayoutRect& dirtyRect, const LayoutRect& layerRepaintRect, OptionSet<PaintBehavior> paintBehavior, OptionSet<RenderLayer::PaintLayerFlag> paintFlags, const RenderObject* subtreePaintRoot)
 {
     if (!m_filter)
         return nullptr;
@@ -157,6 +165,20 @@ GraphicsContext* RenderLayerFilters::beginFilterEffect(GraphicsContext& destinat
         }
     }
     m_paintOffset = filterSourceRect.location();
+
+    // Repaints inside the layer are only accumulated in the dirty source rect for filters that move pixels. For those,
+    // an empty dirty source rect over the same backing store means the source image is unchanged, so the output of
+    // the previous apply is still valid, even if the paint was triggered by content next to the layer. The source also
+    // depends on what is painted: composited layers paint their background, foreground and mask phases separately.
+    bool sourceImageMayHaveChanged = !filter.hasFilterThatMovesPixels() || hasUpdatedBackingStore || !m_dirtySourceRect.isEmpty();
+    bool paintsSameContent = paintBehavior == m_paintBehaviorForOutput && paintFlags == m_paintFlagsForOutput && !subtreePaintRoot;
+    if (sourceImageMayHaveChanged || !paintsSameContent)
+        filter.clearIntermediateResults();
+    m_paintBehaviorForOutput = paintBehavior;
+    m_paintFlagsForOutput = paintFlags;
+    // A paint restricted to a subtree only captures part of the layer, so its output must not be drawn by later paints.
+    m_canRetainOutput = !subtreePaintRoot;
+
     resetDirtySourceRect();
 
     filter.determineFilterPrimitiveSubregion();
@@ -184,7 +206,8 @@ void RenderLayerFilters::applyFilterEffect(GraphicsContext& destinationContext)
     auto& filter = *m_filter;
     filter.inputContext()->restore();
 
-    filter.apply();
+    if (!filter.hasOutputFromSoftwareApply())
+        filter.apply();
 
     // Get the filtered output and draw it in place.
     LayoutRect destRect = filter.outputRect();
@@ -193,7 +216,13 @@ void RenderLayerFilters::applyFilterEffect(GraphicsContext& destinationContext)
     if (auto* outputBuffer = filter.output())
         destinationContext.drawImageBuffer(*outputBuffer, snapRectToDevicePixels(destRect, m_layer.renderer().document().deviceScaleFactor()));
 
-    filter.clearIntermediateResults();
+    if (filter.hasFilterThatMovesPixels() && m_canRetainOutput && !MemoryPressureHandler::singleton().isUnderMemoryPressure()) {
+        filter.clearIntermediateResultsExceptOutput();
+        // Do not hold on to the output of a filter that is no longer repainted.
+        const Seconds outputPurgeInterval { 1_s };
+        m_purgeOutputTimer.startOneShot(outputPurgeInterval);
+    } else
+        filter.clearIntermediateResults();
 
     LOG_WITH_STREAM(Filters, stream << "RenderLayerFilters " << this << " applyFilterEffect done\n");
 }
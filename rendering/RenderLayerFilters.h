@@ -33,6 +33,7 @@
 #include "CachedResourceHandle.h"
 #include "CachedSVGDocumentClient.h"
 #include "RenderLayer.h"
+#include "Timer.h"
 
 namespace WebCore {
 
@@ -63,12 +64,13 @@ public:
     // Per render
     LayoutRect repaintRect() const { return m_repaintRect; }
 
-    GraphicsContext* beginFilterEffect(GraphicsContext& destinationContext, const LayoutRect& filterBoxRect, const LayoutRect& dirtyRect, const LayoutRect& layerRepaintRect);
+    GraphicsContext* beginFilterEffect(GraphicsContext& destinationContext, const LayoutRect& filterBoxRect, const LayoutRect& dirtyRect, const LayoutRect& layerRepaintRect, OptionSet<PaintBehavior>, OptionSet<RenderLayer::PaintLayerFlag>, const RenderObject* subtreePaintRoot);
     void applyFilterEffect(GraphicsContext& destinationContext);
 
 private:
     void notifyFinished(CachedResource&, const NetworkLoadMetrics&) final;
     void resetDirtySourceRect() { m_dirtySourceRect = LayoutRect(); }
+    void purgeOutputTimerFired();
 
     RenderLayer& m_layer;
 
@@ -81,6 +83,12 @@ private:
     // Data used per paint
     LayoutPoint m_paintOffset;
     LayoutRect m_repaintRect;
+
+    // The output of the last software apply is kept so it can be drawn again while the layer contents are unchanged.
+    OptionSet<PaintBehavior> m_paintBehaviorForOutput;
+    OptionSet<RenderLayer::PaintLayerFlag> m_paintFlagsForOutput;
+    bool m_canRetainOutput { false };
+    Timer m_purgeOutputTimer;
 };
 
 } // namespace WebCore
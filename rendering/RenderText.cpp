@@ -1459,8 +1459,14 @@ void RenderText::setText(const String& text, bool force)
     m_knownToHaveNoOverflowAndNoFallbackFonts = false;
 
 #if ENABLE(LAYOUT_FORMATTING_CONTEXT)
-    if (auto* container = LayoutIntegration::LineLayout::blockContainer(*this))
-        container->invalidateLineLayoutPath();
+    if (auto* container = LayoutIntegration::LineLayout::blockContainer(*this)) {
+        // Keep the line layout (and its box tree) around when the new content is still supported. Only the damaged lines get laid out again.
+        auto* lineLayout = container->modernLineLayout();
+        if (lineLayout && LayoutIntegration::LineLayout::canUseForAfterTextContentChange(*container, *this))
+            lineLayout->updateTextContent(*this);
+        else
+            container->invalidateLineLayoutPath();
+    }
 #endif
 
     if (AXObjectCache* cache = document().existingAXObjectCache())
@@ -61,14 +61,19 @@ static ContainingFragmentMap& containingFragmentMap(RenderBlockFlow& block)
     return block.enclosingFragmentedFlow()->containingFragmentMap();
 }
 
+size_t RootInlineBox::s_instanceCount { 0 };
+
 RootInlineBox::RootInlineBox(RenderBlockFlow& block)
     : InlineFlowBox(block)
 {
     setIsHorizontal(block.isHorizontalWritingMode());
+    ++s_instanceCount;
 }
 
 RootInlineBox::~RootInlineBox()
 {
+    ASSERT(s_instanceCount);
+    --s_instanceCount;
     detachEllipsisBox();
 
     if (blockFlow().enclosingFragmentedFlow())
@@ -42,6 +42,9 @@ public:
     explicit RootInlineBox(RenderBlockFlow&);
     virtual ~RootInlineBox();
 
+    // Number of legacy lines currently alive (reported through the memory usage statistics).
+    static size_t instanceCount() { return s_instanceCount; }
+
     RenderBlockFlow& blockFlow() const;
 
     void detachEllipsisBox();
@@ -219,6 +222,8 @@ private:
     std::unique_ptr<CleanLineFloatList> m_floats;
 
     unsigned m_lineBreakPos { 0 };
+
+    static size_t s_instanceCount;
 };
 
 inline RootInlineBox* RootInlineBox::nextRootBox() const
@@ -386,7 +386,7 @@ void ElementRuleCollector::matchUARules()
 {
     // First we match rules from the user agent sheet.
     auto* userAgentStyleSheet = m_isPrintStyle
-        ? UserAgentStyle::defaultPrintStyle : UserAgentStyle::defaultStyle;
+        ? &UserAgentStyle::ensureDefaultPrintStyle() : UserAgentStyle::defaultStyle;
     matchUARules(*userAgentStyleSheet);
 
     // In quirks mode, we match rules from the quirks user agent sheet.
@@ -98,14 +98,15 @@ const MatchedDeclarationsCache::Entry* MatchedDeclarationsCache::find(unsigned h
         return nullptr;
 
     auto it = m_entries.find(hash);
-    if (it == m_entries.end())
+    if (it == m_entries.end() || matchResult != it->value.matchResult) {
+        ++m_statistics.missCount;
         return nullptr;
+    }
 
-    auto& entry = it->value;
-    if (matchResult != entry.matchResult)
-        return nullptr;
+    ++m_statistics.hitCount;
+    m_recentlyUsedHashes.appendOrMoveToLast(hash);
 
-    return &entry;
+    return &it->value;
 }
 
 void MatchedDeclarationsCache::add(const RenderStyle& style, const RenderStyle& parentStyle, unsigned hash, const MatchResult& matchResult)
@@ -117,20 +118,48 @@ void MatchedDeclarationsCache::add(const RenderStyle& style, const RenderStyle&
     }
 
     ASSERT(hash);
+    if (m_entries.contains(hash))
+        return;
+
+    // Documents with many distinct rule combinations would otherwise grow the cache until the next sweep.
+    constexpr unsigned maximumSize = 4096;
+    if (m_entries.size() >= maximumSize)
+        evictLeastRecentlyUsedEntry();
+
     // Note that we don't cache the original RenderStyle instance. It may be further modified.
     // The RenderStyle in the cache is really just a holder for the substructures and never used as-is.
     m_entries.add(hash, Entry { matchResult, RenderStyle::clonePtr(style), RenderStyle::clonePtr(parentStyle) });
+    m_recentlyUsedHashes.add(hash);
+}
+
+void MatchedDeclarationsCache::evictLeastRecentlyUsedEntry()
+{
+    ASSERT(!m_recentlyUsedHashes.isEmpty());
+    m_entries.remove(m_recentlyUsedHashes.takeFirst());
+    ++m_statistics.evictionCount;
+}
+
+template<typename Predicate>
+void MatchedDeclarationsCache::removeEntriesIf(Predicate&& predicate)
+{
+    m_entries.removeIf([&](auto& keyValue) {
+        if (!predicate(keyValue.value))
+            return false;
+        m_recentlyUsedHashes.remove(keyValue.key);
+        return true;
+    });
 }
 
 void MatchedDeclarationsCache::invalidate()
 {
     m_entries.clear();
+    m_recentlyUsedHashes.clear();
 }
 
 void MatchedDeclarationsCache::clearEntriesAffectedByViewportUnits()
 {
-    m_entries.removeIf([](auto& keyValue) {
-        return keyValue.value.renderStyle->hasViewportUnits();
+    removeEntriesIf([](auto& entry) {
+        return entry.renderStyle->hasViewportUnits();
     });
 }
 
@@ -147,8 +176,8 @@ void MatchedDeclarationsCache::sweep()
         return false;
     };
 
-    m_entries.removeIf([&](auto& keyValue) {
-        auto& matchResult = keyValue.value.matchResult;
+    removeEntriesIf([&](auto& entry) {
+        auto& matchResult = entry.matchResult;
         return hasOneRef(matchResult.userAgentDeclarations) || hasOneRef(matchResult.userDeclarations) || hasOneRef(matchResult.authorDeclarations);
     });
 
@@ -28,6 +28,7 @@
 #include "ElementRuleCollector.h"
 #include "RenderStyle.h"
 #include "Timer.h"
+#include <wtf/ListHashSet.h>
 
 namespace WebCore {
 
@@ -58,12 +59,25 @@ public:
     void invalidate();
     void clearEntriesAffectedByViewportUnits();
 
+    struct Statistics {
+        unsigned hitCount { 0 };
+        unsigned missCount { 0 };
+        unsigned evictionCount { 0 };
+    };
+    const Statistics& statistics() const { return m_statistics; }
+    unsigned size() const { return m_entries.size(); }
+
 private:
     void sweep();
+    void evictLeastRecentlyUsedEntry();
+    template<typename Predicate> void removeEntriesIf(Predicate&&);
 
     HashMap<unsigned, Entry> m_entries;
+    // Entry hashes ordered from least to most recently used.
+    ListHashSet<unsigned> m_recentlyUsedHashes;
     Timer m_sweepTimer;
     unsigned m_additionsSinceLastSweep { 0 };
+    Statistics m_statistics;
 };
 
 }
@@ -68,7 +68,7 @@ void PageRuleCollector::matchAllPageRules(int pageIndex)
     const bool isFirst = isFirstPage(pageIndex);
     const String page = pageName(pageIndex);
     
-    matchPageRules(UserAgentStyle::defaultPrintStyle, isLeft, isFirst, page);
+    matchPageRules(&UserAgentStyle::ensureDefaultPrintStyle(), isLeft, isFirst, page);
     matchPageRules(m_ruleSets.userStyle(), isLeft, isFirst, page);
     // Only consider the global author RuleSet for @page rules, as per the HTML5 spec.
     if (m_ruleSets.isAuthorStyleDefined())
@@ -140,15 +140,18 @@ Invalidator::CheckDescendants Invalidator::invalidateIfNeeded(Element& element,
 
     switch (element.styleValidity()) {
     case Style::Validity::Valid: {
+        bool didInvalidate = false;
         for (auto& ruleSet : m_ruleSets) {
             ElementRuleCollector ruleCollector(element, *ruleSet, filter);
             ruleCollector.setMode(SelectorChecker::Mode::CollectingRulesIgnoringVirtualPseudoElements);
 
             if (ruleCollector.matchesAnyAuthorRules()) {
                 element.invalidateStyleInternal();
+                didInvalidate = true;
                 break;
             }
         }
+        element.document().didCheckElementForStyleInvalidation(didInvalidate);
 
         return CheckDescendants::Yes;
     }
@@ -136,6 +136,13 @@ void Resolver::appendAuthorStyleSheets(const Vector<RefPtr<CSSStyleSheet>>& styl
         renderView->style().fontCascade().update(&document().fontSelector());
 }
 
+Ref<RuleSet> Resolver::appendAuthorStyleRule(CSSStyleSheet& styleSheet, const StyleRule& rule)
+{
+    auto ruleSet = m_ruleSets.appendAuthorStyleRule(rule, m_mediaQueryEvaluator);
+    m_inspectorCSSOMWrappers.collectFromStyleSheetIfNeeded(&styleSheet);
+    return ruleSet;
+}
+
 // This is a simplified style setting function for keyframe styles
 void Resolver::addKeyframeStyle(Ref<StyleRuleKeyframes>&& rule)
 {
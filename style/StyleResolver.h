@@ -99,6 +99,7 @@ public:
     const Settings& settings() const { return m_document.settings(); }
 
     void appendAuthorStyleSheets(const Vector<RefPtr<CSSStyleSheet>>&);
+    Ref<RuleSet> appendAuthorStyleRule(CSSStyleSheet&, const StyleRule&);
 
     ScopeRuleSets& ruleSets() { return m_ruleSets; }
     const ScopeRuleSets& ruleSets() const { return m_ruleSets; }
@@ -140,6 +141,7 @@ public:
     
     void invalidateMatchedDeclarationsCache();
     void clearCachedDeclarationsAffectedByViewportUnits();
+    const MatchedDeclarationsCache& matchedDeclarationsCache() const { return m_matchedDeclarationsCache; }
 
     InspectorCSSOMWrappers& inspectorCSSOMWrappers() { return m_inspectorCSSOMWrappers; }
 
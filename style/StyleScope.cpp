@@ -657,6 +657,38 @@ void Scope::didChangeStyleSheetContents()
     scheduleUpdate(UpdateType::ContentsOrInterpretation);
 }
 
+bool Scope::didAppendStyleRule(CSSStyleSheet& sheet, const StyleRule& rule)
+{
+    if (m_pendingUpdate || !m_resolver || m_isUpdatingStyleResolver)
+        return false;
+
+    if (!m_document.hasLivingRenderTree() || m_document.inStyleRecalc() || m_document.inRenderTreeUpdate())
+        return false;
+
+    // Rule positions in the author rule set follow the order of the active stylesheets, so only appending to the last one is position preserving.
+    if (m_activeStyleSheets.isEmpty() || m_activeStyleSheets.last() != &sheet || sheet.mediaQueries())
+        return false;
+
+    auto& contents = sheet.contents();
+    if (!contents.ruleCount() || contents.ruleAt(contents.ruleCount() - 1) != &rule)
+        return false;
+
+    auto ruleSet = m_resolver->appendAuthorStyleRule(sheet, rule);
+
+    if (contents.usesStyleBasedEditability())
+        m_usesStyleBasedEditability = true;
+
+    bool invalidateAll = !m_document.bodyOrFrameset() || m_document.hasNodesWithNonFinalStyle() || m_document.hasNodesWithMissingStyle();
+    if (invalidateAll) {
+        Invalidator::invalidateAllStyle(*this);
+        return true;
+    }
+
+    Invalidator invalidator({ ruleSet.ptr() });
+    invalidator.invalidateStyle(*this);
+    return true;
+}
+
 void Scope::didChangeStyleSheetEnvironment()
 {
     if (!m_shadowRoot) {
@@ -43,6 +43,7 @@ class Document;
 class Element;
 class Node;
 class ProcessingInstruction;
+class StyleRule;
 class StyleSheet;
 class StyleSheetContents;
 class StyleSheetList;
@@ -104,6 +105,9 @@ public:
     void didChangeActiveStyleSheetCandidates();
     // This is called when contents of a stylesheet is mutated.
     void didChangeStyleSheetContents();
+    // This is called when a style rule is appended to an active stylesheet through CSSOM.
+    // Returns false if the change can't be applied incrementally and the caller should fall back to didChangeStyleSheetContents().
+    bool didAppendStyleRule(CSSStyleSheet&, const StyleRule&);
     // This is called when the environment where we intrepret the stylesheets changes (for example switching to printing).
     // The change is assumed to potentially affect all author and user stylesheets including shadow roots.
     WEBCORE_EXPORT void didChangeStyleSheetEnvironment();
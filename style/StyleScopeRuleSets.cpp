@@ -186,6 +186,42 @@ void ScopeRuleSets::appendAuthorStyleSheets(const Vector<RefPtr<CSSStyleSheet>>&
     collectFeatures();
 }
 
+Ref<RuleSet> ScopeRuleSets::appendAuthorStyleRule(const StyleRule& rule, const MediaQueryEvaluator& mediaQueryEvaluator)
+{
+    RELEASE_ASSERT(!m_isInvalidatingStyleWithRuleSets);
+
+    // Bring the collected features up to date before the author rule set changes so the new rule is merged only once.
+    auto& features = mutableFeatures();
+
+    RuleSet::MediaQueryCollector authorMediaQueryCollector { mediaQueryEvaluator };
+    m_authorStyle->addStyleRule(rule, authorMediaQueryCollector);
+
+    auto ruleSet = RuleSet::create();
+    RuleSet::MediaQueryCollector mediaQueryCollector { mediaQueryEvaluator };
+    ruleSet->addStyleRule(rule, mediaQueryCollector);
+
+    // Merge the features of the new rule instead of recollecting them from every rule set.
+    auto& newFeatures = ruleSet->features();
+    features.add(newFeatures);
+
+    if (!newFeatures.siblingRules.isEmpty())
+        m_siblingRuleSet = makeRuleSet(features.siblingRules);
+    if (!newFeatures.uncommonAttributeRules.isEmpty())
+        m_uncommonAttributeRuleSet = makeRuleSet(features.uncommonAttributeRules);
+
+    // Only the invalidation rule sets for keys the rule contributes to are stale.
+    for (auto& className : newFeatures.classRules.keys())
+        m_classInvalidationRuleSets.remove(className);
+    for (auto& attributeName : newFeatures.attributeRules.keys())
+        m_attributeInvalidationRuleSets.remove(attributeName);
+    for (auto& pseudoClass : newFeatures.pseudoClassRules.keys())
+        m_pseudoClassInvalidationRuleSets.remove(pseudoClass);
+
+    m_cachedHasComplexSelectorsForStyleAttribute = WTF::nullopt;
+
+    return ruleSet;
+}
+
 void ScopeRuleSets::collectFeatures() const
 {
     RELEASE_ASSERT(!m_isInvalidatingStyleWithRuleSets);
@@ -76,6 +76,8 @@ public:
 
     void resetAuthorStyle();
     void appendAuthorStyleSheets(const Vector<RefPtr<CSSStyleSheet>>&, MediaQueryEvaluator*, Style::InspectorCSSOMWrappers&);
+    // Returns a rule set containing only the appended rule, suitable for style invalidation.
+    Ref<RuleSet> appendAuthorStyleRule(const StyleRule&, const MediaQueryEvaluator&);
 
     void resetUserAgentMediaQueryStyle();
 
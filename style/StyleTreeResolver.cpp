@@ -100,12 +100,27 @@ TreeResolver::Scope::~Scope()
 TreeResolver::Parent::Parent(Document& document)
     : element(nullptr)
     , style(*document.renderStyle())
+    , boxStyle(&style)
 {
 }
 
-TreeResolver::Parent::Parent(Element& element, const RenderStyle& style, Change change, DescendantsToResolve descendantsToResolve)
+static const RenderStyle* computeBoxStyle(const RenderStyle& style, const RenderStyle* enclosingBoxStyle)
+{
+    // 'display: contents' doesn't generate boxes.
+    switch (style.display()) {
+    case DisplayType::None:
+        return nullptr;
+    case DisplayType::Contents:
+        return enclosingBoxStyle;
+    default:
+        return &style;
+    }
+}
+
+TreeResolver::Parent::Parent(Element& element, const RenderStyle& style, const RenderStyle* enclosingBoxStyle, Change change, DescendantsToResolve descendantsToResolve)
     : element(&element)
     , style(style)
+    , boxStyle(computeBoxStyle(style, enclosingBoxStyle))
     , change(change)
     , descendantsToResolve(descendantsToResolve)
 {
@@ -152,7 +167,7 @@ std::unique_ptr<RenderStyle> TreeResolver::styleForStyleable(const Styleable& st
     return WTFMove(elementStyle.renderStyle);
 }
 
-static void resetStyleForNonRenderedDescendants(Element& current)
+void resetStyleForNonRenderedDescendants(Element& current)
 {
     for (auto& child : childrenOfType<Element>(current)) {
         if (child.needsStyleRecalc()) {
@@ -292,20 +307,6 @@ Optional<ElementUpdate> TreeResolver::resolvePseudoStyle(Element& element, const
     return createAnimatedElementUpdate(WTFMove(pseudoStyle), { element, pseudoId }, elementUpdate.change, parentStyle, parentBoxStyle);
 }
 
-const RenderStyle* TreeResolver::parentBoxStyle() const
-{
-    // 'display: contents' doesn't generate boxes.
-    for (auto i = m_parentStack.size(); i--;) {
-        auto& parent = m_parentStack[i];
-        if (parent.style.display() == DisplayType::None)
-            return nullptr;
-        if (parent.style.display() != DisplayType::Contents)
-            return &parent.style;
-    }
-    ASSERT_NOT_REACHED();
-    return nullptr;
-}
-
 const RenderStyle* TreeResolver::parentBoxStyleForPseudo(const ElementUpdate& elementUpdate) const
 {
     switch (elementUpdate.style->display()) {
@@ -381,7 +382,7 @@ void TreeResolver::pushParent(Element& element, const RenderStyle& style, Change
 {
     scope().selectorFilter.pushParent(&element);
 
-    Parent parent(element, style, change, descendantsToResolve);
+    Parent parent(element, style, parentBoxStyle(), change, descendantsToResolve);
 
     if (auto* shadowRoot = element.shadowRoot()) {
         pushScope(*shadowRoot);
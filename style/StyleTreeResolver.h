@@ -80,12 +80,13 @@ private:
     struct Parent {
         Element* element;
         const RenderStyle& style;
+        const RenderStyle* boxStyle;
         Change change { Change::None };
         DescendantsToResolve descendantsToResolve { DescendantsToResolve::None };
         bool didPushScope { false };
 
         Parent(Document&);
-        Parent(Element&, const RenderStyle&, Change, DescendantsToResolve);
+        Parent(Element&, const RenderStyle&, const RenderStyle* enclosingBoxStyle, Change, DescendantsToResolve);
     };
 
     Scope& scope() { return m_scopeStack.last(); }
@@ -99,7 +100,7 @@ private:
     void popParent();
     void popParentsToDepth(unsigned depth);
 
-    const RenderStyle* parentBoxStyle() const;
+    const RenderStyle* parentBoxStyle() const { return m_parentStack.last().boxStyle; }
     const RenderStyle* parentBoxStyleForPseudo(const ElementUpdate&) const;
 
     Document& m_document;
@@ -112,6 +113,9 @@ private:
     std::unique_ptr<Update> m_update;
 };
 
+// Drops computed styles and clears invalidation in a subtree that has no renderers.
+void resetStyleForNonRenderedDescendants(Element&);
+
 void queuePostResolutionCallback(Function<void ()>&&);
 bool postResolutionCallbacksAreSuspended();
 
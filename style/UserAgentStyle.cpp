@@ -99,6 +99,13 @@ static const MediaQueryEvaluator& printEval()
     return staticPrintEval;
 }
 
+// The print rule set is only needed when printing, so it is built from these on first use.
+static Vector<StyleSheetContents*>& sheetsInDefaultStyle()
+{
+    static NeverDestroyed<Vector<StyleSheetContents*>> sheets;
+    return sheets;
+}
+
 static StyleSheetContents* parseUASheet(const String& str)
 {
     StyleSheetContents& sheet = StyleSheetContents::create(CSSParserContext(UASheetMode)).leakRef(); // leak the sheet on purpose
@@ -114,7 +121,10 @@ static StyleSheetContents* parseUASheet(const char* characters, unsigned size)
 void UserAgentStyle::addToDefaultStyle(StyleSheetContents& sheet)
 {
     defaultStyle->addRulesFromSheet(sheet, screenEval());
-    defaultPrintStyle->addRulesFromSheet(sheet, printEval());
+    if (defaultPrintStyle)
+        defaultPrintStyle->addRulesFromSheet(sheet, printEval());
+    else
+        sheetsInDefaultStyle().append(&sheet);
 
     // Build a stylesheet consisting of non-trivial media queries seen in default style.
     // Rulesets for these can't be global and need to be built in document context.
@@ -139,7 +149,6 @@ void UserAgentStyle::initDefaultStyleSheet()
         return;
 
     defaultStyle = &RuleSet::create().leakRef();
-    defaultPrintStyle = &RuleSet::create().leakRef();
     defaultQuirksStyle = &RuleSet::create().leakRef();
     mediaQueryStyleSheet = &StyleSheetContents::create(CSSParserContext(UASheetMode)).leakRef();
 
@@ -156,6 +165,17 @@ void UserAgentStyle::initDefaultStyleSheet()
     ++defaultStyleVersion;
 }
 
+RuleSet& UserAgentStyle::ensureDefaultPrintStyle()
+{
+    if (!defaultPrintStyle) {
+        defaultPrintStyle = &RuleSet::create().leakRef();
+        for (auto* sheet : sheetsInDefaultStyle())
+            defaultPrintStyle->addRulesFromSheet(*sheet, printEval());
+        sheetsInDefaultStyle().clear();
+    }
+    return *defaultPrintStyle;
+}
+
 void UserAgentStyle::ensureDefaultStyleSheetsForElement(const Element& element)
 {
     if (is<HTMLElement>(element)) {
@@ -35,7 +35,6 @@ class UserAgentStyle {
 public:
     static RuleSet* defaultStyle;
     static RuleSet* defaultQuirksStyle;
-    static RuleSet* defaultPrintStyle;
     static unsigned defaultStyleVersion;
 
     static StyleSheetContents* defaultStyleSheet;
@@ -61,9 +60,12 @@ public:
 
     static void initDefaultStyleSheet();
     static void ensureDefaultStyleSheetsForElement(const Element&);
+    static RuleSet& ensureDefaultPrintStyle();
 
 private:
     static void addToDefaultStyle(StyleSheetContents&);
+
+    static RuleSet* defaultPrintStyle;
 };
 
 } // namespace Style
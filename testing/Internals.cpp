@@ -41,6 +41,7 @@
 #include "CSSMediaRule.h"
 #include "CSSPropertyParser.h"
 #include "CSSStyleRule.h"
+#include "CSSStyleSheet.h"
 #include "CSSSupportsRule.h"
 #include "CacheStorageConnection.h"
 #include "CacheStorageProvider.h"
@@ -115,6 +116,7 @@
 #include "InternalsSetLike.h"
 #include "JSDOMPromiseDeferred.h"
 #include "JSImageData.h"
+#include "LayoutIntegrationCoverage.h"
 #include "LegacySchemeRegistry.h"
 #include "LibWebRTCProvider.h"
 #include "LoaderStrategy.h"
@@ -3471,6 +3473,48 @@ ExceptionOr<unsigned> Internals::layerFlushCount()
     return document->renderView()->compositor().layerFlushCount();
 }
 
+ExceptionOr<void> Internals::startTrackingLayoutStatistics()
+{
+    Document* document = contextDocument();
+    if (!document || !document->view())
+        return Exception { InvalidAccessError };
+
+    document->view()->layoutContext().startTrackingLayoutStatistics();
+    return { };
+}
+
+ExceptionOr<void> Internals::stopTrackingLayoutStatistics()
+{
+    Document* document = contextDocument();
+    if (!document || !document->view())
+        return Exception { InvalidAccessError };
+
+    document->view()->layoutContext().stopTrackingLayoutStatistics();
+    return { };
+}
+
+ExceptionOr<Vector<Internals::LayoutStatistics>> Internals::layoutStatistics()
+{
+    Document* document = contextDocument();
+    if (!document || !document->view())
+        return Exception { InvalidAccessError };
+
+    Vector<LayoutStatistics> result;
+    auto* layoutStatistics = document->view()->layoutContext().layoutStatistics();
+    if (!layoutStatistics)
+        return result;
+
+    for (auto& entry : *layoutStatistics) {
+        auto& statistics = entry.value;
+        result.append({ entry.key, statistics.layoutCount, statistics.layoutTime.milliseconds(), statistics.selfNeedsLayoutCount,
+            statistics.positionedMovementCount, statistics.childNeedsLayoutCount, statistics.simplifiedNormalFlowCount });
+    }
+    std::sort(result.begin(), result.end(), [](auto& a, auto& b) {
+        return a.layoutTime > b.layoutTime;
+    });
+    return result;
+}
+
 ExceptionOr<void> Internals::startTrackingStyleRecalcs()
 {
     Document* document = contextDocument();
@@ -3498,6 +3542,102 @@ unsigned Internals::lastStyleUpdateSize() const
     return document->lastStyleUpdateSizeForTesting();
 }
 
+ExceptionOr<unsigned> Internals::styleInvalidationCheckCount()
+{
+    Document* document = contextDocument();
+    if (!document)
+        return Exception { InvalidAccessError };
+
+    return document->styleInvalidationCheckCount();
+}
+
+ExceptionOr<unsigned> Internals::styleInvalidationCount()
+{
+    Document* document = contextDocument();
+    if (!document)
+        return Exception { InvalidAccessError };
+
+    return document->styleInvalidationCount();
+}
+
+ExceptionOr<Internals::MatchedDeclarationsCacheStatistics> Internals::matchedDeclarationsCacheStatistics()
+{
+    Document* document = contextDocument();
+    if (!document)
+        return Exception { InvalidAccessError };
+
+    auto& cache = document->styleScope().resolver().matchedDeclarationsCache();
+    auto& statistics = cache.statistics();
+    return MatchedDeclarationsCacheStatistics { cache.size(), statistics.hitCount, statistics.missCount, statistics.evictionCount };
+}
+
+ExceptionOr<Vector<Internals::LineLayoutAvoidanceReasonStatistics>> Internals::lineLayoutAvoidanceReasonStatistics()
+{
+    Document* document = contextDocument();
+    if (!document)
+        return Exception { InvalidAccessError };
+
+    Vector<LineLayoutAvoidanceReasonStatistics> result;
+#if ENABLE(LAYOUT_FORMATTING_CONTEXT)
+    document->updateLayoutIgnorePendingStylesheets();
+    for (auto& statistics : LayoutIntegration::collectAvoidanceReasonStatistics(*document)) {
+        TextStream stream;
+        stream << statistics.reason;
+        result.append({ stream.release(), statistics.blockCount, statistics.lineCount, statistics.textLength });
+    }
+#endif
+    return result;
+}
+
+static String selectorCompilationStatusString(const StyleRule& rule, unsigned selectorListIndex)
+{
+#if ENABLE(CSS_SELECTOR_JIT)
+    switch (rule.compiledSelectorForListIndex(selectorListIndex).status) {
+    case SelectorCompilationStatus::NotCompiled:
+        return "not-compiled"_s;
+    case SelectorCompilationStatus::CannotCompile:
+        return "interpreted"_s;
+    case SelectorCompilationStatus::SimpleSelectorChecker:
+    case SelectorCompilationStatus::SelectorCheckerWithCheckingContext:
+        return "compiled"_s;
+    }
+    ASSERT_NOT_REACHED();
+#else
+    UNUSED_PARAM(rule);
+    UNUSED_PARAM(selectorListIndex);
+#endif
+    return "interpreted"_s;
+}
+
+static void collectSelectorCompilationResults(const Vector<RefPtr<StyleRuleBase>>& rules, Vector<Internals::SelectorCompilationResult>& results)
+{
+    for (auto& rule : rules) {
+        if (is<StyleRuleMedia>(*rule)) {
+            if (auto* childRules = downcast<StyleRuleMedia>(*rule).childRulesWithoutDeferredParsing())
+                collectSelectorCompilationResults(*childRules, results);
+            continue;
+        }
+        if (is<StyleRuleSupports>(*rule)) {
+            if (auto* childRules = downcast<StyleRuleSupports>(*rule).childRulesWithoutDeferredParsing())
+                collectSelectorCompilationResults(*childRules, results);
+            continue;
+        }
+        if (!is<StyleRule>(*rule))
+            continue;
+        auto& styleRule = downcast<StyleRule>(*rule);
+        unsigned selectorListIndex = 0;
+        for (auto* selector = styleRule.selectorList().first(); selector; selector = CSSSelectorList::next(selector))
+            results.append({ selector->selectorText(), selectorCompilationStatusString(styleRule, selectorListIndex++) });
+    }
+}
+
+Vector<Internals::SelectorCompilationResult> Internals::selectorCompilationResults(CSSStyleSheet& sheet)
+{
+    Vector<SelectorCompilationResult> results;
+    collectSelectorCompilationResults(sheet.contents().childRules(), results);
+    return results;
+}
+
 ExceptionOr<void> Internals::startTrackingCompositingUpdates()
 {
     Document* document = contextDocument();
@@ -51,6 +51,7 @@ class AbstractRange;
 class AnimationTimeline;
 class AudioContext;
 class AudioTrack;
+class CSSStyleSheet;
 class CacheStorageConnection;
 class DOMRect;
 class DOMRectList;
@@ -542,9 +543,46 @@ public:
     ExceptionOr<void> startTrackingLayerFlushes();
     ExceptionOr<unsigned> layerFlushCount();
 
+    struct LayoutStatistics {
+        String name;
+        unsigned layoutCount;
+        double layoutTime;
+        unsigned selfNeedsLayoutCount;
+        unsigned positionedMovementCount;
+        unsigned childNeedsLayoutCount;
+        unsigned simplifiedNormalFlowCount;
+    };
+    ExceptionOr<void> startTrackingLayoutStatistics();
+    ExceptionOr<void> stopTrackingLayoutStatistics();
+    ExceptionOr<Vector<LayoutStatistics>> layoutStatistics();
+
     ExceptionOr<void> startTrackingStyleRecalcs();
     ExceptionOr<unsigned> styleRecalcCount();
     unsigned lastStyleUpdateSize() const;
+    ExceptionOr<unsigned> styleInvalidationCheckCount();
+    ExceptionOr<unsigned> styleInvalidationCount();
+
+    struct MatchedDeclarationsCacheStatistics {
+        unsigned size;
+        unsigned hitCount;
+        unsigned missCount;
+        unsigned evictionCount;
+    };
+    ExceptionOr<MatchedDeclarationsCacheStatistics> matchedDeclarationsCacheStatistics();
+
+    struct LineLayoutAvoidanceReasonStatistics {
+        String reason;
+        unsigned blockCount;
+        unsigned lineCount;
+        unsigned textLength;
+    };
+    ExceptionOr<Vector<LineLayoutAvoidanceReasonStatistics>> lineLayoutAvoidanceReasonStatistics();
+
+    struct SelectorCompilationResult {
+        String selectorText;
+        String status;
+    };
+    Vector<SelectorCompilationResult> selectorCompilationResults(CSSStyleSheet&);
 
     ExceptionOr<void> startTrackingCompositingUpdates();
     ExceptionOr<unsigned> compositingUpdateCount();